@@ -0,0 +1,83 @@
+import * as flags from "https://deno.land/std/flags/mod.ts";
+import * as path from "https://deno.land/std/path/mod.ts";
+
+// builds a sorted lookup index for a GB2312 cFONT table so that
+// Paint_DrawString_CN can binary search instead of scanning the table
+
+const cliFlags = flags.parse(Deno.args);
+
+function helpAndExit() {
+	console.log("Usage: <input fontCN.c> <output_index.h>");
+	Deno.exit(1);
+}
+
+if (cliFlags._.length < 2) helpAndExit();
+if (!String(cliFlags._[1]).endsWith(".h")) helpAndExit();
+
+const inputFile = String(cliFlags._[0]);
+const outputFile = String(cliFlags._[1]);
+
+// font sources are GB2312, read as latin1 so every char is one byte
+const source = new TextDecoder("latin1").decode(
+	await Deno.readFile(inputFile),
+);
+
+const tableName = source.match(/const\s+CH_CN\s+(\w+)\s*\[\]/)?.[1];
+if (tableName == null) {
+	throw new Error("Failed to find CH_CN table in " + inputFile);
+}
+
+// every entry starts with {{"<1 or 2 bytes>"},{ possibly split over lines
+
+const entryRegex = /\{\s*\{\s*"([^"]{1,2})"\s*\}\s*,\s*\{/g;
+
+const entries: { code: number; entry: number }[] = [];
+const seen = new Set<number>();
+
+let match: RegExpExecArray | null;
+let entry = 0;
+
+while ((match = entryRegex.exec(source)) != null) {
+	const bytes = match[1];
+	const code =
+		(bytes.charCodeAt(0) << 8) | (bytes.length > 1 ? bytes.charCodeAt(1) : 0);
+
+	// linear scan would find the first one, so keep that
+	if (!seen.has(code)) {
+		seen.add(code);
+		entries.push({ code, entry });
+	}
+
+	entry++;
+}
+
+if (entries.length == 0) {
+	throw new Error("No entries found in " + inputFile);
+}
+
+entries.sort((a, b) => a.code - b.code);
+
+const varName = tableName.replace(/_Table$/, "_Index");
+const headerName = path
+	.basename(outputFile)
+	.replace(/\.h$/, "")
+	.toUpperCase();
+
+const cData = entries
+	.map(
+		({ code, entry }) =>
+			`\t{0x${code.toString(16).toUpperCase().padStart(4, "0")}, ${entry}},`,
+	)
+	.join("\n");
+
+const cOut = `
+#ifndef ${headerName}
+#define ${headerName}
+// generated by assets/make-cn-font-index.ts from ${path.basename(inputFile)}
+const CH_CN_INDEX ${varName}[${entries.length}] = {
+${cData}
+};
+#endif
+`;
+
+await Deno.writeTextFile(outputFile, cOut.trim() + "\n");
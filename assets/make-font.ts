@@ -0,0 +1,415 @@
+import * as flags from "https://deno.land/std/flags/mod.ts";
+import * as path from "https://deno.land/std/path/mod.ts";
+import opentype from "npm:opentype.js@1.3.4";
+
+// compiles a ttf/otf or bdf font into an aFONT header for
+// Paint_DrawString_AA: proportional glyphs, kerning pairs, 2 or 4 bit alpha
+
+const cliFlags = flags.parse(Deno.args, {
+	default: { size: 20, bpp: 4, first: 32, last: 126 },
+});
+
+function helpAndExit() {
+	console.log(
+		"Usage: <input .ttf/.otf/.bdf> <output.h> [--size 20] [--bpp 4] [--first 32] [--last 126]",
+	);
+	Deno.exit(1);
+}
+
+if (cliFlags._.length < 2) helpAndExit();
+if (!String(cliFlags._[1]).endsWith(".h")) helpAndExit();
+
+const inputFile = String(cliFlags._[0]);
+const outputFile = String(cliFlags._[1]);
+const size = Number(cliFlags.size);
+const bpp = Number(cliFlags.bpp);
+const first = Number(cliFlags.first);
+const last = Number(cliFlags.last);
+
+if (bpp != 2 && bpp != 4) helpAndExit();
+
+const maxLevel = (1 << bpp) - 1;
+
+interface Glyph {
+	code: number;
+	width: number;
+	height: number;
+	xOffset: number;
+	yOffset: number;
+	advance: number;
+	alpha: number[]; // 0 to 1, width * height
+}
+
+interface Kern {
+	left: number;
+	right: number;
+	adjust: number;
+}
+
+// vector fonts
+
+type Point = [number, number];
+
+function flattenPath(commands: any[]): Point[][] {
+	const contours: Point[][] = [];
+	let contour: Point[] = [];
+	let current: Point = [0, 0];
+
+	const steps = 8;
+
+	for (const c of commands) {
+		if (c.type == "M") {
+			if (contour.length > 0) contours.push(contour);
+			contour = [[c.x, c.y]];
+			current = [c.x, c.y];
+		} else if (c.type == "L") {
+			contour.push([c.x, c.y]);
+			current = [c.x, c.y];
+		} else if (c.type == "Q") {
+			for (let i = 1; i <= steps; i++) {
+				const t = i / steps;
+				const u = 1 - t;
+				contour.push([
+					u * u * current[0] + 2 * u * t * c.x1 + t * t * c.x,
+					u * u * current[1] + 2 * u * t * c.y1 + t * t * c.y,
+				]);
+			}
+			current = [c.x, c.y];
+		} else if (c.type == "C") {
+			for (let i = 1; i <= steps; i++) {
+				const t = i / steps;
+				const u = 1 - t;
+				contour.push([
+					u * u * u * current[0] +
+						3 * u * u * t * c.x1 +
+						3 * u * t * t * c.x2 +
+						t * t * t * c.x,
+					u * u * u * current[1] +
+						3 * u * u * t * c.y1 +
+						3 * u * t * t * c.y2 +
+						t * t * t * c.y,
+				]);
+			}
+			current = [c.x, c.y];
+		} else if (c.type == "Z") {
+			if (contour.length > 0) contours.push(contour);
+			contour = [];
+		}
+	}
+
+	if (contour.length > 0) contours.push(contour);
+
+	return contours;
+}
+
+// nonzero winding coverage, sampled on a 4x4 grid per pixel
+function rasterize(
+	contours: Point[][],
+	x0: number,
+	y0: number,
+	width: number,
+	height: number,
+): number[] {
+	const samples = 4;
+	const coverage = new Array(width * height).fill(0);
+
+	for (let row = 0; row < height * samples; row++) {
+		const y = y0 + (row + 0.5) / samples;
+
+		const crossings: { x: number; winding: number }[] = [];
+
+		for (const contour of contours) {
+			for (let i = 0; i < contour.length; i++) {
+				const [ax, ay] = contour[i];
+				const [bx, by] = contour[(i + 1) % contour.length];
+				if (ay == by) continue;
+				if ((y < ay && y < by) || (y >= ay && y >= by)) continue;
+				const t = (y - ay) / (by - ay);
+				crossings.push({ x: ax + t * (bx - ax), winding: by > ay ? 1 : -1 });
+			}
+		}
+
+		crossings.sort((a, b) => a.x - b.x);
+
+		let winding = 0;
+		for (let i = 0; i < crossings.length - 1; i++) {
+			winding += crossings[i].winding;
+			if (winding == 0) continue;
+
+			const start = (crossings[i].x - x0) * samples;
+			const end = (crossings[i + 1].x - x0) * samples;
+
+			for (let s = Math.ceil(start - 0.5); s + 0.5 < end; s++) {
+				if (s < 0 || s >= width * samples) continue;
+				const pixel = Math.floor(row / samples) * width + Math.floor(s / samples);
+				coverage[pixel] += 1 / (samples * samples);
+			}
+		}
+	}
+
+	return coverage;
+}
+
+function loadVectorFont(data: Uint8Array): {
+	glyphs: Glyph[];
+	kerning: Kern[];
+	lineHeight: number;
+} {
+	const font = opentype.parse(data.buffer);
+	const scale = size / font.unitsPerEm;
+	const ascent = font.ascender * scale;
+
+	const glyphs: Glyph[] = [];
+	const kerning: Kern[] = [];
+
+	for (let code = first; code <= last; code++) {
+		const glyph = font.charToGlyph(String.fromCharCode(code));
+		const contours = flattenPath(glyph.getPath(0, ascent, size).commands);
+
+		const points = contours.flat();
+
+		let x0 = 0,
+			y0 = 0,
+			width = 0,
+			height = 0;
+
+		if (points.length > 0) {
+			x0 = Math.floor(Math.min(...points.map(p => p[0])));
+			y0 = Math.floor(Math.min(...points.map(p => p[1])));
+			width = Math.ceil(Math.max(...points.map(p => p[0]))) - x0;
+			height = Math.ceil(Math.max(...points.map(p => p[1]))) - y0;
+		}
+
+		glyphs.push({
+			code,
+			width,
+			height,
+			xOffset: x0,
+			yOffset: y0,
+			advance: Math.round(glyph.advanceWidth * scale),
+			alpha: rasterize(contours, x0, y0, width, height),
+		});
+
+		for (let right = first; right <= last; right++) {
+			const rightGlyph = font.charToGlyph(String.fromCharCode(right));
+			const adjust = Math.round(
+				font.getKerningValue(glyph, rightGlyph) * scale,
+			);
+			if (adjust != 0) kerning.push({ left: code, right, adjust });
+		}
+	}
+
+	return {
+		glyphs,
+		kerning,
+		lineHeight: Math.round((font.ascender - font.descender) * scale),
+	};
+}
+
+// bitmap fonts
+
+function loadBdfFont(source: string): {
+	glyphs: Glyph[];
+	kerning: Kern[];
+	lineHeight: number;
+} {
+	const lines = source.split(/\r?\n/);
+
+	let ascent = 0;
+	let descent = 0;
+
+	const glyphs: Glyph[] = [];
+
+	for (let i = 0; i < lines.length; i++) {
+		const [keyword, ...args] = lines[i].trim().split(/\s+/);
+
+		if (keyword == "FONT_ASCENT") ascent = Number(args[0]);
+		if (keyword == "FONT_DESCENT") descent = Number(args[0]);
+		if (keyword != "STARTCHAR") continue;
+
+		let code = -1;
+		let advance = 0;
+		let bbx = [0, 0, 0, 0];
+		const rows: string[] = [];
+
+		for (i++; i < lines.length; i++) {
+			const [key, ...values] = lines[i].trim().split(/\s+/);
+			if (key == "ENCODING") code = Number(values[0]);
+			else if (key == "DWIDTH") advance = Number(values[0]);
+			else if (key == "BBX") bbx = values.map(Number);
+			else if (key == "BITMAP") {
+				for (i++; lines[i].trim() != "ENDCHAR"; i++) {
+					rows.push(lines[i].trim());
+				}
+				break;
+			}
+		}
+
+		if (code < first || code > last) continue;
+
+		const [width, height, xOffset, yOffset] = bbx;
+
+		const alpha: number[] = [];
+		for (const row of rows) {
+			const bits = row
+				.split("")
+				.map(hex => parseInt(hex, 16).toString(2).padStart(4, "0"))
+				.join("");
+			for (let x = 0; x < width; x++) alpha.push(bits[x] == "1" ? 1 : 0);
+		}
+
+		glyphs.push({
+			code,
+			width,
+			height,
+			xOffset,
+			// bdf offsets are from the baseline, up
+			yOffset: ascent - (yOffset + height),
+			advance,
+			alpha,
+		});
+	}
+
+	return { glyphs, kerning: [], lineHeight: ascent + descent };
+}
+
+const inputData = await Deno.readFile(inputFile);
+
+const { glyphs, kerning, lineHeight } = inputFile.toLowerCase().endsWith(".bdf")
+	? loadBdfFont(new TextDecoder().decode(inputData))
+	: loadVectorFont(inputData);
+
+// fill missing characters so glyphs can be indexed by code
+
+const glyphsByCode = new Map(glyphs.map(glyph => [glyph.code, glyph]));
+
+const bitmap: number[] = [];
+const glyphTable: string[] = [];
+
+for (let code = first; code <= last; code++) {
+	const glyph = glyphsByCode.get(code);
+
+	if (glyph == null) {
+		glyphTable.push(`\t{0, 0, 0, 0, 0, 0}, // missing ${code}`);
+		continue;
+	}
+
+	// trim fully transparent rows and columns
+
+	const levels = glyph.alpha.map(a =>
+		Math.min(maxLevel, Math.max(0, Math.round(a * maxLevel))),
+	);
+
+	let left = glyph.width,
+		right = -1,
+		top = glyph.height,
+		bottom = -1;
+
+	for (let y = 0; y < glyph.height; y++) {
+		for (let x = 0; x < glyph.width; x++) {
+			if (levels[y * glyph.width + x] == 0) continue;
+			left = Math.min(left, x);
+			right = Math.max(right, x);
+			top = Math.min(top, y);
+			bottom = Math.max(bottom, y);
+		}
+	}
+
+	const offset = bitmap.length;
+	let width = 0,
+		height = 0;
+
+	if (right >= 0) {
+		width = right - left + 1;
+		height = bottom - top + 1;
+
+		let bits = 0;
+		let bitCount = 0;
+
+		for (let y = top; y <= bottom; y++) {
+			for (let x = left; x <= right; x++) {
+				bits = (bits << bpp) | levels[y * glyph.width + x];
+				bitCount += bpp;
+				if (bitCount == 8) {
+					bitmap.push(bits);
+					bits = 0;
+					bitCount = 0;
+				}
+			}
+		}
+
+		if (bitCount > 0) bitmap.push((bits << (8 - bitCount)) & 0xff);
+	}
+
+	const clampInt8 = (v: number) => Math.max(-128, Math.min(127, v));
+
+	const printable =
+		code >= 32 && code < 127 && code != 92 ? String.fromCharCode(code) : code;
+
+	glyphTable.push(
+		`\t{${offset}, ${width}, ${height}, ${clampInt8(
+			glyph.xOffset + (right >= 0 ? left : 0),
+		)}, ${clampInt8(glyph.yOffset + (right >= 0 ? top : 0))}, ${Math.min(
+			255,
+			Math.max(0, glyph.advance),
+		)}}, // ${printable}`,
+	);
+}
+
+if (bitmap.length > 0xffff) {
+	throw new Error("Bitmap too big for 16 bit offsets, try a smaller size");
+}
+
+kerning.sort((a, b) => a.left - b.left || a.right - b.right);
+
+const varName = path.basename(outputFile).replace(/\.h$/, "");
+const headerName = varName.toUpperCase();
+
+const cBitmap = [];
+for (let i = 0; i < bitmap.length; i += 16) {
+	cBitmap.push("\t" + bitmap.slice(i, i + 16).join(",") + ",");
+}
+
+const cKerning =
+	kerning.length > 0
+		? kerning
+				.map(k => `\t{${k.left}, ${k.right}, ${Math.max(-128, Math.min(127, k.adjust))}},`)
+				.join("\n")
+		: "\t{0, 0, 0},";
+
+const cOut = `
+#ifndef ${headerName}
+#define ${headerName}
+// generated by assets/make-font.ts from ${path.basename(
+	inputFile,
+)}, ${size}px, ${bpp} bit alpha
+#include "fonts.h"
+const uint8_t ${varName}_bitmap[${Math.max(1, bitmap.length)}] = {
+${cBitmap.join("\n") || "\t0,"}
+};
+const aGLYPH ${varName}_glyphs[${last - first + 1}] = {
+${glyphTable.join("\n")}
+};
+const aKERN ${varName}_kerning[${Math.max(1, kerning.length)}] = {
+${cKerning}
+};
+const aFONT ${varName} = {
+	${varName}_bitmap,
+	${varName}_glyphs,
+	${varName}_kerning,
+	${kerning.length},
+	${first},
+	${last},
+	${bpp},
+	${lineHeight},
+};
+#endif
+`;
+
+await Deno.writeTextFile(outputFile, cOut.trim() + "\n");
+
+console.log(
+	`${varName}: ${last - first + 1} glyphs, ${kerning.length} kerning pairs, ${
+		bitmap.length
+	} bytes of bitmap`,
+);
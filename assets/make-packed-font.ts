@@ -0,0 +1,169 @@
+import * as flags from "https://deno.land/std/flags/mod.ts";
+import * as path from "https://deno.land/std/path/mod.ts";
+
+// packs an ascii sFONT table into its bounding boxes so most of the
+// background bits never reach flash. decoded again by Font_GetGlyph
+
+const cliFlags = flags.parse(Deno.args);
+
+function helpAndExit() {
+	console.log("Usage: <input font.c> <output_packed.c>");
+	Deno.exit(1);
+}
+
+if (cliFlags._.length < 2) helpAndExit();
+if (!String(cliFlags._[1]).endsWith(".c")) helpAndExit();
+
+const inputFile = String(cliFlags._[0]);
+const outputFile = String(cliFlags._[1]);
+
+const source = await Deno.readTextFile(inputFile);
+
+const fontMatch = source.match(
+	/sFONT\s+(\w+)\s*=\s*\{\s*(\w+),\s*(\d+),[^\n]*\n\s*(\d+),/,
+);
+if (fontMatch == null) {
+	throw new Error("Failed to find sFONT in " + inputFile);
+}
+
+const fontName = fontMatch[1];
+const tableName = fontMatch[2];
+const width = Number(fontMatch[3]);
+const height = Number(fontMatch[4]);
+
+const tableStart = source.indexOf("{", source.indexOf(tableName));
+const tableEnd = source.indexOf("};", tableStart);
+
+const table = source
+	.slice(tableStart + 1, tableEnd)
+	.replace(/\/\/.*$/gm, "") // glyph previews
+	.replace(/\/\*[\s\S]*?\*\//g, "")
+	.match(/0x[0-9a-fA-F]{2}/g)!
+	.map(v => parseInt(v, 16));
+
+const widthBytes = Math.ceil(width / 8);
+const rowBits = widthBytes * 8;
+const glyphBytes = widthBytes * height;
+const totalGlyphs = table.length / glyphBytes;
+
+if (!Number.isInteger(totalGlyphs)) {
+	throw new Error("Table size doesn't match " + width + "x" + height);
+}
+
+// glyph format:
+//
+// [uint8: top row] [uint8: rows] [uint8: left column] [uint8: columns]
+//
+// ...rows * columns bits, msb first, no padding between rows
+//
+// empty glyphs have no bytes at all
+
+const packed: number[] = [];
+const offsets: number[] = [];
+
+for (let glyph = 0; glyph < totalGlyphs; glyph++) {
+	offsets.push(packed.length);
+
+	const rows: number[] = [];
+	for (let row = 0; row < height; row++) {
+		let value = 0;
+		for (let i = 0; i < widthBytes; i++) {
+			value = value * 256 + table[glyph * glyphBytes + row * widthBytes + i];
+		}
+		rows.push(value);
+	}
+
+	const nonEmpty = rows
+		.map((value, row) => (value != 0 ? row : -1))
+		.filter(row => row != -1);
+
+	if (nonEmpty.length == 0) continue;
+
+	const top = nonEmpty[0];
+	const bottom = nonEmpty[nonEmpty.length - 1];
+
+	let used = 0;
+	for (const value of rows) used |= value;
+
+	// columns counted from the left, msb is column 0
+	let left = 0;
+	while (!((used >> (rowBits - 1 - left)) & 1)) left++;
+	let right = rowBits - 1;
+	while (!((used >> (rowBits - 1 - right)) & 1)) right--;
+
+	const columns = right - left + 1;
+
+	packed.push(top, bottom - top + 1, left, columns);
+
+	let bitBuffer = 0;
+	let bitCount = 0;
+
+	for (let row = top; row <= bottom; row++) {
+		for (let column = left; column <= right; column++) {
+			const bit = (rows[row] >> (rowBits - 1 - column)) & 1;
+			bitBuffer = (bitBuffer << 1) | bit;
+			bitCount++;
+			if (bitCount == 8) {
+				packed.push(bitBuffer);
+				bitBuffer = 0;
+				bitCount = 0;
+			}
+		}
+	}
+
+	if (bitCount > 0) packed.push(bitBuffer << (8 - bitCount));
+}
+
+offsets.push(packed.length);
+
+function hexLines(values: number[], digits: number, perLine: number) {
+	const lines: string[] = [];
+	for (let i = 0; i < values.length; i += perLine) {
+		lines.push(
+			"\t" +
+				values
+					.slice(i, i + perLine)
+					.map(
+						v =>
+							"0x" + v.toString(16).toUpperCase().padStart(digits, "0"),
+					)
+					.join(", ") +
+				",",
+		);
+	}
+	return lines.join("\n");
+}
+
+const cOut = `
+// generated by assets/make-packed-font.ts from ${path.basename(inputFile)}
+#include "fonts.h"
+#include <stddef.h>
+
+#ifdef FONTS_PACKED
+
+const uint16_t ${fontName}_Offsets[${offsets.length}] = {
+${hexLines(offsets, 4, 12)}
+};
+
+const uint8_t ${fontName}_Packed[${packed.length}] = {
+${hexLines(packed, 2, 16)}
+};
+
+sFONT ${fontName} = {
+  NULL,
+  ${width}, /* Width */
+  ${height}, /* Height */
+  ${fontName}_Packed,
+  ${fontName}_Offsets,
+};
+
+#endif
+`;
+
+await Deno.writeTextFile(outputFile, cOut.trim() + "\n");
+
+console.log(
+	`${fontName}: ${table.length} bytes -> ${
+		packed.length + offsets.length * 2
+	} bytes`,
+);
@@ -0,0 +1,285 @@
+import * as flags from "https://deno.land/std/flags/mod.ts";
+import {
+	FilterType,
+	ImageMagick,
+	initialize,
+} from "https://deno.land/x/imagemagick_deno/mod.ts";
+import * as path from "https://deno.land/std/path/mod.ts";
+
+// makes a signed distance field for sdfDraw, see src/sdf.h. takes an image,
+// where dark is inside (flip with --invert), or an ascii sFONT .c table.
+// the shape is rasterized big, then the exact distance to its edge is
+// sampled down to --size field pixels. a font keeps only the --glyphs
+// characters when given, a whole font is tens of kilobytes
+
+const cliFlags = flags.parse(Deno.args, {
+	boolean: ["invert"],
+	string: ["glyphs"],
+	default: { size: 64, spread: 4 },
+});
+
+function helpAndExit() {
+	console.log(
+		"Usage: <input image or font.c> <output.h> [--size 64] [--spread 4] [--invert] [--glyphs abc]",
+	);
+	Deno.exit(1);
+}
+
+if (cliFlags._.length < 2) helpAndExit();
+if (!String(cliFlags._[1]).endsWith(".h")) helpAndExit();
+
+const inputFile = String(cliFlags._[0]);
+const outputFile = String(cliFlags._[1]);
+const size = Number(cliFlags.size);
+const spread = Number(cliFlags.spread);
+// sorted and without repeats, sdfDrawString looks them up in order
+const glyphs =
+	cliFlags.glyphs == null
+		? null
+		: [...new Set(String(cliFlags.glyphs))].sort().join("");
+
+// sdfDraw keeps its math in 32 bits up to this
+if (spread < 1 || spread > 16) {
+	throw new Error("Spread should be between 1 and 16");
+}
+
+// high resolution pixels per field pixel
+const upscale = 8;
+
+// exact squared euclidean distance transform, felzenszwalb and huttenlocher
+
+const INF = 1e20;
+
+function edt1d(f: Float64Array, n: number, d: Float64Array) {
+	const v = new Int32Array(n);
+	const z = new Float64Array(n + 1);
+	let k = 0;
+	v[0] = 0;
+	z[0] = -INF;
+	z[1] = INF;
+	for (let q = 1; q < n; q++) {
+		let s: number;
+		while (true) {
+			const p = v[k];
+			s = (f[q] + q * q - (f[p] + p * p)) / (2 * q - 2 * p);
+			if (s > z[k]) break;
+			k--;
+		}
+		k++;
+		v[k] = q;
+		z[k] = s;
+		z[k + 1] = INF;
+	}
+	k = 0;
+	for (let q = 0; q < n; q++) {
+		while (z[k + 1] < q) k++;
+		const p = v[k];
+		d[q] = (q - p) * (q - p) + f[p];
+	}
+}
+
+// distance from each pixel to the nearest pixel where set is true
+function edt(set: Uint8Array, width: number, height: number): Float64Array {
+	const grid = new Float64Array(width * height);
+	for (let i = 0; i < grid.length; i++) grid[i] = set[i] ? 0 : INF;
+
+	const n = Math.max(width, height);
+	const f = new Float64Array(n);
+	const d = new Float64Array(n);
+
+	for (let x = 0; x < width; x++) {
+		for (let y = 0; y < height; y++) f[y] = grid[y * width + x];
+		edt1d(f, height, d);
+		for (let y = 0; y < height; y++) grid[y * width + x] = d[y];
+	}
+	for (let y = 0; y < height; y++) {
+		for (let x = 0; x < width; x++) f[x] = grid[y * width + x];
+		edt1d(f, width, d);
+		for (let x = 0; x < width; x++) grid[y * width + x] = Math.sqrt(d[x]);
+	}
+
+	return grid;
+}
+
+// shape is high resolution, fieldWidth * upscale wide, including padding
+function makeField(
+	shape: Uint8Array,
+	fieldWidth: number,
+	fieldHeight: number,
+): number[] {
+	const width = fieldWidth * upscale;
+	const height = fieldHeight * upscale;
+
+	const outside = shape.map(v => (v ? 0 : 1));
+	const toInside = edt(shape, width, height);
+	const toOutside = edt(outside, width, height);
+
+	const out: number[] = [];
+
+	for (let fy = 0; fy < fieldHeight; fy++) {
+		for (let fx = 0; fx < fieldWidth; fx++) {
+			// middle of the field pixel, between high resolution pixels
+			const x = fx * upscale + upscale / 2;
+			const y = fy * upscale + upscale / 2;
+
+			let total = 0;
+			for (const [dx, dy] of [
+				[-1, -1],
+				[0, -1],
+				[-1, 0],
+				[0, 0],
+			]) {
+				const i = (y + dy) * width + (x + dx);
+				// pixel centers sit half a pixel off the edge
+				total += shape[i] ? toOutside[i] - 0.5 : -(toInside[i] - 0.5);
+			}
+
+			const distance = total / 4 / upscale;
+			out.push(
+				Math.max(0, Math.min(255, Math.round(128 + (distance * 127) / spread))),
+			);
+		}
+	}
+
+	return out;
+}
+
+const padding = Math.ceil(spread);
+
+let fieldWidth: number;
+let fieldHeight: number;
+let count = 1;
+let first = 0;
+let advance = 0;
+const data: number[] = [];
+
+if (inputFile.endsWith(".c")) {
+	// same parsing as make-packed-font.ts
+
+	const source = await Deno.readTextFile(inputFile);
+
+	const fontMatch = source.match(
+		/sFONT\s+(\w+)\s*=\s*\{\s*(\w+),\s*(\d+),[^\n]*\n\s*(\d+),/,
+	);
+	if (fontMatch == null) {
+		throw new Error("Failed to find sFONT in " + inputFile);
+	}
+
+	const tableName = fontMatch[2];
+	const width = Number(fontMatch[3]);
+	const height = Number(fontMatch[4]);
+
+	const tableStart = source.indexOf("{", source.indexOf(tableName));
+	const tableEnd = source.indexOf("};", tableStart);
+
+	const table = source
+		.slice(tableStart + 1, tableEnd)
+		.replace(/\/\/.*$/gm, "")
+		.replace(/\/\*[\s\S]*?\*\//g, "")
+		.match(/0x[0-9a-fA-F]{2}/g)!
+		.map(v => parseInt(v, 16));
+
+	const widthBytes = Math.ceil(width / 8);
+	const glyphBytes = widthBytes * height;
+
+	count = table.length / glyphBytes;
+	first = 32; // sFONT tables start at space
+	advance = width;
+
+	if (!Number.isInteger(count)) {
+		throw new Error("Table size doesn't match " + width + "x" + height);
+	}
+
+	// font pixels are taken as field pixels, blocky but true to the font
+	fieldWidth = width + padding * 2;
+	fieldHeight = height + padding * 2;
+
+	const codes = glyphs == null
+		? Array.from({ length: count }, (_, i) => first + i)
+		: [...glyphs].map(c => c.charCodeAt(0));
+
+	for (const code of codes) {
+		const glyph = code - first;
+		if (glyph < 0 || glyph >= count) {
+			throw new Error("No glyph for " + JSON.stringify(String.fromCharCode(code)));
+		}
+
+		const shape = new Uint8Array(fieldWidth * upscale * fieldHeight * upscale);
+
+		for (let y = 0; y < shape.length / (fieldWidth * upscale); y++) {
+			for (let x = 0; x < fieldWidth * upscale; x++) {
+				const column = Math.floor(x / upscale) - padding;
+				const row = Math.floor(y / upscale) - padding;
+				if (column < 0 || column >= width || row < 0 || row >= height) {
+					continue;
+				}
+				const byte =
+					table[glyph * glyphBytes + row * widthBytes + (column >> 3)];
+				shape[y * fieldWidth * upscale + x] = (byte >> (7 - (column & 7))) & 1;
+			}
+		}
+
+		data.push(...makeField(shape, fieldWidth, fieldHeight));
+	}
+
+	count = codes.length;
+} else {
+	await initialize(); // imagemagick
+
+	const inputData: Uint8Array = await Deno.readFile(inputFile);
+
+	fieldWidth = size;
+	fieldHeight = size;
+
+	const inner = (size - padding * 2) * upscale;
+
+	// have to do some callbacks because it disposes early
+	const pixels = await new Promise<Uint8Array | null>(resolve => {
+		ImageMagick.read(inputData, image => {
+			image.filterType = FilterType.Lanczos2;
+			image.resize(inner, inner);
+			image.getPixels(async pixelCollection => {
+				resolve(pixelCollection.toByteArray(0, 0, inner, inner, "rgb"));
+			});
+		});
+	});
+
+	if (pixels == null) {
+		throw new Error("Failed to resize and get pixels");
+	}
+
+	const width = size * upscale;
+	const shape = new Uint8Array(width * width);
+	const offset = padding * upscale;
+
+	for (let y = 0; y < inner; y++) {
+		for (let x = 0; x < inner; x++) {
+			const i = (y * inner + x) * 3;
+			const luminance = (pixels[i] + pixels[i + 1] + pixels[i + 2]) / 3;
+			const dark = luminance < 128;
+			shape[(y + offset) * width + x + offset] =
+				dark != !!cliFlags.invert ? 1 : 0;
+		}
+	}
+
+	data.push(...makeField(shape, fieldWidth, fieldHeight));
+}
+
+const varName = path.basename(outputFile).replace(/\.h$/, "");
+const headerName = varName.toUpperCase();
+
+const cOut = `
+#ifndef ${headerName}
+#define ${headerName}
+// generated by assets/make-sdf.ts from ${path.basename(inputFile)}
+#include "../sdf.h"
+const uint8_t ${varName}_data[${data.length}] = {${data.join(",")}};
+const SdfField ${varName} = {${fieldWidth}, ${fieldHeight}, ${spread}, ${count}, ${first}, ${advance}, ${varName}_data, ${glyphs == null ? "NULL" : JSON.stringify(glyphs)}};
+#endif
+`;
+
+await Deno.writeTextFile(outputFile, cOut.trim() + "\n");
+
+console.log(
+	`${varName}: ${count} x ${fieldWidth}x${fieldHeight}, ${data.length} bytes`,
+);
@@ -0,0 +1,278 @@
+import * as flags from "https://deno.land/std/flags/mod.ts";
+import * as path from "https://deno.land/std/path/mod.ts";
+
+// compiles the filled shapes of an svg into the compact path format that
+// vectorDraw renders, see src/vector.h. supports <path>, <rect>, <circle>,
+// <ellipse> and <polygon> with a solid fill. no arcs, strokes or transforms
+
+const cliFlags = flags.parse(Deno.args);
+
+function helpAndExit() {
+	console.log("Usage: <input .svg> <output.h>");
+	Deno.exit(1);
+}
+
+if (cliFlags._.length < 2) helpAndExit();
+if (!String(cliFlags._[1]).endsWith(".h")) helpAndExit();
+
+const inputFile = String(cliFlags._[0]);
+const outputFile = String(cliFlags._[1]);
+
+const VECTOR_END = 0;
+const VECTOR_COLOR = 1;
+const VECTOR_MOVE = 2;
+const VECTOR_LINE = 3;
+const VECTOR_QUAD = 4;
+const VECTOR_CUBIC = 5;
+const VECTOR_CLOSE = 6;
+const VECTOR_FILL = 7;
+
+// src/vector.h, edges per fill and lines per curve at most
+const VECTOR_MAX_EDGES = 384;
+const CURVE_MAX_SEGMENTS = 32;
+
+const svg = await Deno.readTextFile(inputFile);
+
+const viewBox = svg
+	.match(/viewBox\s*=\s*"([^"]+)"/)?.[1]
+	.trim()
+	.split(/[\s,]+/)
+	.map(Number);
+
+if (viewBox == null || viewBox.length != 4) {
+	throw new Error("Svg needs a viewBox");
+}
+
+const [viewX, viewY, viewWidth, viewHeight] = viewBox;
+
+if (viewWidth > 2047 || viewHeight > 2047) {
+	throw new Error("View box too big for 1/16 unit int16 coordinates");
+}
+
+const out: number[] = [];
+
+function writeInt16(value: number) {
+	const int = Math.max(-32768, Math.min(32767, Math.round(value)));
+	out.push(int & 0xff, (int >> 8) & 0xff);
+}
+
+function writePoint(x: number, y: number) {
+	writeInt16((x - viewX) * 16);
+	writeInt16((y - viewY) * 16);
+}
+
+writeInt16(viewWidth);
+writeInt16(viewHeight);
+
+// colors
+
+function parseColor(value: string | undefined): number[] | null {
+	if (value == null) return null;
+	value = value.trim().toLowerCase();
+	if (value == "none" || value == "transparent") return null;
+	if (value == "black") return [0, 0, 0];
+	if (value == "white") return [255, 255, 255];
+
+	let hex = value.match(/^#([0-9a-f]{3}|[0-9a-f]{6})$/)?.[1];
+	if (hex == null) {
+		const rgb = value.match(/^rgb\(\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*\)$/);
+		if (rgb == null) throw new Error("Unsupported color " + value);
+		return [Number(rgb[1]), Number(rgb[2]), Number(rgb[3])];
+	}
+	if (hex.length == 3) hex = hex.replace(/./g, c => c + c);
+	return [0, 2, 4].map(i => parseInt(hex!.slice(i, i + 2), 16));
+}
+
+function attribute(tag: string, name: string): string | undefined {
+	const style = tag.match(/\sstyle\s*=\s*"([^"]*)"/)?.[1];
+	const fromStyle = style?.match(new RegExp(`(?:^|;)\\s*${name}\\s*:\\s*([^;]+)`))?.[1];
+	if (fromStyle != null) return fromStyle;
+	return tag.match(new RegExp(`\\s${name}\\s*=\\s*"([^"]*)"`))?.[1];
+}
+
+let lastColor = "";
+
+function setColor(color: number[]) {
+	if (color.join() == lastColor) return;
+	lastColor = color.join();
+	out.push(VECTOR_COLOR, ...color);
+}
+
+// paths
+
+function writePathData(d: string) {
+	const tokens = d.match(/[a-zA-Z]|-?(?:\d+\.?\d*|\.\d+)(?:e-?\d+)?/g) ?? [];
+
+	let i = 0;
+	let command = "";
+	let x = 0,
+		y = 0,
+		startX = 0,
+		startY = 0;
+	// last control point, for the smooth S and T commands
+	let controlX = 0,
+		controlY = 0;
+	let lastCommand = "";
+
+	const number = () => Number(tokens[i++]);
+	// flattened as they will be at any scale, curves as many lines as they
+	// can become, and every contour closes
+	let edges = 0;
+
+	while (i < tokens.length) {
+		if (/[a-zA-Z]/.test(tokens[i])) command = tokens[i++];
+
+		const relative = command == command.toLowerCase();
+		const ox = relative ? x : 0;
+		const oy = relative ? y : 0;
+		const upper = command.toUpperCase();
+
+		if (upper == "M") {
+			x = ox + number();
+			y = oy + number();
+			startX = x;
+			startY = y;
+			edges++;
+			out.push(VECTOR_MOVE);
+			writePoint(x, y);
+			// extra pairs after a move are lines
+			command = relative ? "l" : "L";
+		} else if (upper == "L") {
+			x = ox + number();
+			y = oy + number();
+			edges++;
+			out.push(VECTOR_LINE);
+			writePoint(x, y);
+		} else if (upper == "H") {
+			x = ox + number();
+			edges++;
+			out.push(VECTOR_LINE);
+			writePoint(x, y);
+		} else if (upper == "V") {
+			y = oy + number();
+			edges++;
+			out.push(VECTOR_LINE);
+			writePoint(x, y);
+		} else if (upper == "Q" || upper == "T") {
+			let cx, cy;
+			if (upper == "Q") {
+				cx = ox + number();
+				cy = oy + number();
+			} else {
+				const smooth = "QT".includes(lastCommand.toUpperCase());
+				cx = smooth ? 2 * x - controlX : x;
+				cy = smooth ? 2 * y - controlY : y;
+			}
+			x = ox + number();
+			y = oy + number();
+			edges += CURVE_MAX_SEGMENTS;
+			out.push(VECTOR_QUAD);
+			writePoint(cx, cy);
+			writePoint(x, y);
+			controlX = cx;
+			controlY = cy;
+		} else if (upper == "C" || upper == "S") {
+			let c1x, c1y;
+			if (upper == "C") {
+				c1x = ox + number();
+				c1y = oy + number();
+			} else {
+				const smooth = "CS".includes(lastCommand.toUpperCase());
+				c1x = smooth ? 2 * x - controlX : x;
+				c1y = smooth ? 2 * y - controlY : y;
+			}
+			const c2x = ox + number();
+			const c2y = oy + number();
+			x = ox + number();
+			y = oy + number();
+			edges += CURVE_MAX_SEGMENTS;
+			out.push(VECTOR_CUBIC);
+			writePoint(c1x, c1y);
+			writePoint(c2x, c2y);
+			writePoint(x, y);
+			controlX = c2x;
+			controlY = c2y;
+		} else if (upper == "Z") {
+			edges++;
+			out.push(VECTOR_CLOSE);
+			x = startX;
+			y = startY;
+		} else if (upper == "A") {
+			throw new Error("Arcs aren't supported, convert them to curves");
+		} else {
+			throw new Error("Unknown path command " + command);
+		}
+
+		lastCommand = upper == "M" ? "M" : command;
+	}
+
+	// the fill closes the last contour
+	return edges + 1;
+}
+
+// 4 cubics, kappa is the control distance for a quarter circle
+function ellipsePath(cx: number, cy: number, rx: number, ry: number): string {
+	const kx = rx * 0.5522847;
+	const ky = ry * 0.5522847;
+	return (
+		`M${cx + rx},${cy} ` +
+		`C${cx + rx},${cy + ky} ${cx + kx},${cy + ry} ${cx},${cy + ry} ` +
+		`C${cx - kx},${cy + ry} ${cx - rx},${cy + ky} ${cx - rx},${cy} ` +
+		`C${cx - rx},${cy - ky} ${cx - kx},${cy - ry} ${cx},${cy - ry} ` +
+		`C${cx + kx},${cy - ry} ${cx + rx},${cy - ky} ${cx + rx},${cy} Z`
+	);
+}
+
+const shapes = svg.match(/<(path|rect|circle|ellipse|polygon)\b[^>]*>/g) ?? [];
+let shapeCount = 0;
+
+for (const tag of shapes) {
+	const color = parseColor(attribute(tag, "fill") ?? "black");
+	if (color == null) continue;
+
+	const number = (name: string) => Number(attribute(tag, name) ?? 0);
+	const name = tag.match(/^<(\w+)/)![1];
+
+	let d = "";
+	if (name == "path") {
+		d = attribute(tag, "d") ?? "";
+	} else if (name == "rect") {
+		const [x, y, w, h] = ["x", "y", "width", "height"].map(number);
+		d = `M${x},${y} H${x + w} V${y + h} H${x} Z`;
+	} else if (name == "circle") {
+		const r = number("r");
+		d = ellipsePath(number("cx"), number("cy"), r, r);
+	} else if (name == "ellipse") {
+		d = ellipsePath(number("cx"), number("cy"), number("rx"), number("ry"));
+	} else if (name == "polygon") {
+		d = "M" + (attribute(tag, "points") ?? "") + " Z";
+	}
+
+	setColor(color);
+	const edges = writePathData(d);
+	if (edges > VECTOR_MAX_EDGES) {
+		throw new Error(
+			`Shape ${shapeCount + 1} (<${name}>) can be up to ${edges} edges, ` +
+				`vectorDraw fills at most ${VECTOR_MAX_EDGES} at once. split it up`,
+		);
+	}
+	out.push(VECTOR_FILL);
+	shapeCount++;
+}
+
+out.push(VECTOR_END);
+
+const varName = path.basename(outputFile).replace(/\.h$/, "");
+const headerName = varName.toUpperCase();
+
+const cOut = `
+#ifndef ${headerName}
+#define ${headerName}
+// generated by assets/make-vector.ts from ${path.basename(inputFile)}
+const unsigned char ${varName}[${out.length}] = {${out.join(",")}};
+#endif
+`;
+
+await Deno.writeTextFile(outputFile, cOut.trim() + "\n");
+
+console.log(`${varName}: ${shapeCount} shapes, ${out.length} bytes`);
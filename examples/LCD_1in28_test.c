@@ -34,6 +34,7 @@
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
 #include "CST816S.h"
+#include "../lib/Fonts/lato_20.h"
 
 uint8_t flag = 0;
 
@@ -89,6 +90,8 @@ int LCD_1in28_test(void)
     Paint_DrawString_EN(50, 100, "ABC", &Font20, 0x000f, 0xfff0);
     Paint_DrawString_CN(50, 120, "΢ѩ����", &Font24CN, WHITE, BLUE);
     Paint_DrawString_EN(50, 161, "WaveShare", &Font16, RED, WHITE);
+    Paint_DrawString_AA((240 - Paint_GetStringWidth_AA("Anti-aliased", &lato_20)) / 2,
+                        185, "Anti-aliased", &lato_20, BLACK);
 
     // /*3.Refresh the picture in RAM to LCD*/
     LCD_1IN28_Display(BlackImage);
@@ -102,11 +105,28 @@ int LCD_1in28_test(void)
     DEV_Delay_ms(1000);
 #endif
 
+#if 1
+    // spin the picture once while zooming in and out, every frame is
+    // sampled straight from flash
+    PAINT_AFFINE affine;
+    for (int16_t angle = 0; angle <= ANGLE_FULL_TURN; angle += 8)
+    {
+        int32_t zoom = 65536 + Paint_Sin(angle * 2) / 4;
+        Paint_SetAffine(&affine, angle, zoom, 120, 120, 120, 120);
+        Paint_Clear(WHITE);
+        Paint_DrawImage_Affine(gImage_1inch3_1, 240, 240, &affine, IMAGE_FILTER_BILINEAR);
+        LCD_1IN28_Display(BlackImage);
+    }
+#endif
+
 #if 1
 
-    float acc[3], gyro[3];
+    short acc[3], gyro[3];
     unsigned int tim_count = 0;
-    const float conversion_factor = 3.3f / (1 << 12) * 2;
+    // volts are result * 3.3 / 4096 * 2
+    const int32_t battery_num = 33 * 2, battery_den = 10 * (1 << 12);
+    PAINT_NUM acc_text[3] = {0}, gyro_text[3] = {0}, battery_text = {0};
+    char str[PAINT_NUM_LEN];
 
     CST816S_init(CST816S_Gesture_Mode);
     DEV_KEY_Config(Touch_INT_PIN);
@@ -131,23 +151,25 @@ int LCD_1in28_test(void)
     while (true)
     {
         uint16_t result = adc_read();
-        printf("Raw value: 0x%03x, voltage: %f V\n", result, result * conversion_factor);
-        Paint_Clear(WHITE);
-        QMI8658_read_xyz(acc, gyro, &tim_count);
-        printf("acc_x   = %4.3fmg , acc_y  = %4.3fmg , acc_z  = %4.3fmg\r\n", acc[0], acc[1], acc[2]);
-        printf("gyro_x  = %4.3fdps, gyro_y = %4.3fdps, gyro_z = %4.3fdps\r\n", gyro[0], gyro[1], gyro[2]);
+        printf("Raw value: 0x%03x, voltage: %ld mV\n", result, (long)result * battery_num * 1000 / battery_den);
+        QMI8658_read_xyz_raw(acc, gyro, &tim_count);
+
+        // only the digits that changed are redrawn, no clearing needed
+        int32_t acc_div = QMI8658_get_acc_lsb_div();
+        int32_t gyro_div = QMI8658_get_gyro_lsb_div();
+        for (int i = 0; i < 3; i++)
+        {
+            Paint_FormatNum_Scaled(str, acc[i], 1000, acc_div, 2);
+            Paint_DrawString_EN_Changed(120, 50 + i * 25, str, &acc_text[i], &Font16, BLACK, 0X4F30);
+            Paint_FormatNum_Scaled(str, gyro[i], 1, gyro_div, 2);
+            Paint_DrawString_EN_Changed(120, 125 + i * 25, str, &gyro_text[i], &Font16, BLACK, 0XAD55);
+        }
+        printf("acc (mg)    = %s, %s, %s\r\n", acc_text[0].Text, acc_text[1].Text, acc_text[2].Text);
+        printf("gyro (dps)  = %s, %s, %s\r\n", gyro_text[0].Text, gyro_text[1].Text, gyro_text[2].Text);
 
         printf("tim_count = %d\r\n", tim_count);
-        Paint_DrawRectangle(120, 49,  220, 120, 0X4F30, DOT_PIXEL_2X2, DRAW_FILL_FULL);
-        Paint_DrawRectangle(120, 120, 220, 195, 0XAD55, DOT_PIXEL_2X2, DRAW_FILL_FULL);
-        Paint_DrawRectangle(120, 195, 220, 240, 0X2595, DOT_PIXEL_2X2, DRAW_FILL_FULL);
-        Paint_DrawNum(120, 50, acc[0], &Font16, 2, BLACK , 0X4F30);
-        Paint_DrawNum(120, 75, acc[1], &Font16, 2, BLACK , 0X4F30);
-        Paint_DrawNum(120, 100, acc[2], &Font16, 2, BLACK, 0X4F30);
-        Paint_DrawNum(120, 125, gyro[0], &Font16, 2, BLACK, 0XAD55);
-        Paint_DrawNum(120, 150, gyro[1], &Font16, 2, BLACK, 0XAD55);
-        Paint_DrawNum(120, 175, gyro[2], &Font16, 2, BLACK, 0XAD55);
-        Paint_DrawNum(130, 200, result * conversion_factor, &Font16, 2, BLACK, 0X2595);
+        Paint_FormatNum_Scaled(str, result, battery_num, battery_den, 2);
+        Paint_DrawString_EN_Changed(130, 200, str, &battery_text, &Font16, BLACK, 0X2595);
         LCD_1IN28_DisplayWindows(120, 50, 210, 200, BlackImage);
         LCD_1IN28_DisplayWindows(130, 200, 220, 220, BlackImage);
         DEV_Delay_ms(100);
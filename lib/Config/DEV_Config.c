@@ -146,9 +146,24 @@ void DEV_SET_PWM(uint8_t Value)
     }
     else
     {
-        pwm_set_chan_level(slice_num, PWM_CHAN_B, Value);
+        pwm_set_chan_level(slice_num, PWM_CHAN_B, Value * (DEV_PWM_MAX + 1) / 100);
     }
 }
+
+/******************************************************************************
+function:	Set the backlight at full PWM resolution
+parameter:
+    Level   :   0 to DEV_PWM_MAX + 1
+Info:       The counter wraps after DEV_PWM_MAX, so only DEV_PWM_MAX + 1
+            stays high the whole period. DEV_SET_PWM takes a percentage
+            onto the same range
+******************************************************************************/
+void DEV_SET_PWM_Level(uint16_t Level)
+{
+    if (Level > DEV_PWM_MAX + 1)
+        Level = DEV_PWM_MAX + 1;
+    pwm_set_chan_level(slice_num, PWM_CHAN_B, Level);
+}
 /**
  * IRQ
  **/
@@ -174,9 +189,10 @@ uint8_t DEV_Module_Init(void)
     // PWM Config
     gpio_set_function(LCD_BL_PIN, GPIO_FUNC_PWM);
     slice_num = pwm_gpio_to_slice_num(LCD_BL_PIN);
-    pwm_set_wrap(slice_num, 100);
+    // 12 bit at about 30khz, so the low end of a fade still has steps
+    pwm_set_wrap(slice_num, DEV_PWM_MAX);
     pwm_set_chan_level(slice_num, PWM_CHAN_B, 0);
-    pwm_set_clkdiv(slice_num, 50);
+    pwm_set_clkdiv(slice_num, 1);
     pwm_set_enabled(slice_num, true);
 
     // SPI Config
@@ -88,7 +88,10 @@ void DEV_I2C_Read_nByte(i2c_inst_t *I2C_PORT,uint8_t addr,uint8_t reg, uint8_t *
 
 void DEV_IRQ_SET(uint gpio, uint32_t events, gpio_irq_callback_t callback);
 
+#define DEV_PWM_MAX 4095                              // the wrap, DEV_PWM_MAX + 1 is fully on
+
 void DEV_SET_PWM(uint8_t Value);
+void DEV_SET_PWM_Level(uint16_t Level);
 
 uint8_t DEV_Module_Init(void);
 void DEV_Module_Exit(void);
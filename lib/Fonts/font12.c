@@ -42,6 +42,8 @@
 //  Font data for Courier New 12pt
 // 
 
+#ifndef FONTS_PACKED
+
 const uint8_t Font12_Table[] = 
 {
 	// @0 ' ' (7 pixels wide)
@@ -1381,4 +1383,6 @@ sFONT Font12 = {
   12, /* Height */
 };
 
+#endif
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
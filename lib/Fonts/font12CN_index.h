@@ -0,0 +1,19 @@
+#ifndef FONT12CN_INDEX
+#define FONT12CN_INDEX
+// generated by assets/make-cn-font-index.ts from font12CN.c
+const CH_CN_INDEX Font12CN_Index[13] = {
+	{0x4100, 8},
+	{0x6100, 5},
+	{0x6200, 6},
+	{0x6300, 7},
+	{0xBAC3, 1},
+	{0xBBB6, 9},
+	{0xC4E3, 0},
+	{0xC5C9, 4},
+	{0xCAB9, 11},
+	{0xCAF7, 2},
+	{0xD3AD, 10},
+	{0xD3C3, 12},
+	{0xDDAE, 3},
+};
+#endif
@@ -0,0 +1,82 @@
+// generated by assets/make-packed-font.ts from font12.c
+#include "fonts.h"
+#include <stddef.h>
+
+#ifdef FONTS_PACKED
+
+const uint16_t Font12_Offsets[96] = {
+	0x0000, 0x0000, 0x0005, 0x000B, 0x0015, 0x001E, 0x0027, 0x002F, 0x0034, 0x003B, 0x0042, 0x004A,
+	0x0055, 0x005B, 0x0060, 0x0065, 0x006F, 0x0078, 0x0081, 0x008A, 0x0093, 0x009D, 0x00A6, 0x00AF,
+	0x00B8, 0x00C1, 0x00CA, 0x00D0, 0x00D7, 0x00E1, 0x00E7, 0x00F1, 0x00F9, 0x0104, 0x010F, 0x0119,
+	0x0122, 0x012C, 0x0136, 0x0140, 0x014A, 0x0155, 0x015E, 0x0167, 0x0172, 0x017B, 0x0186, 0x0191,
+	0x019A, 0x01A3, 0x01AD, 0x01B8, 0x01C1, 0x01CC, 0x01D7, 0x01E2, 0x01ED, 0x01F8, 0x0203, 0x020C,
+	0x0214, 0x021D, 0x0225, 0x022C, 0x0231, 0x0236, 0x023F, 0x0249, 0x0251, 0x025B, 0x0263, 0x026C,
+	0x0276, 0x0281, 0x028A, 0x0293, 0x029D, 0x02A6, 0x02B0, 0x02BA, 0x02C2, 0x02CC, 0x02D6, 0x02DE,
+	0x02E6, 0x02F0, 0x02FA, 0x0304, 0x030E, 0x0317, 0x0322, 0x032A, 0x0332, 0x0338, 0x0340, 0x0346,
+};
+
+const uint8_t Font12_Packed[838] = {
+	0x01, 0x08, 0x03, 0x01, 0xF9, 0x01, 0x03, 0x01, 0x05, 0xDC, 0xA4, 0x01, 0x09, 0x01, 0x05, 0x29,
+	0x55, 0xF5, 0x7D, 0x54, 0xA0, 0x01, 0x09, 0x01, 0x04, 0x27, 0x88, 0x79, 0xE2, 0x20, 0x01, 0x08,
+	0x01, 0x05, 0x45, 0x10, 0x3E, 0x08, 0xA2, 0x03, 0x06, 0x01, 0x05, 0x32, 0x11, 0x59, 0x34, 0x01,
+	0x04, 0x03, 0x01, 0xF0, 0x01, 0x0A, 0x03, 0x02, 0x5A, 0xAA, 0x50, 0x01, 0x0A, 0x02, 0x02, 0xA5,
+	0x55, 0xA0, 0x01, 0x05, 0x01, 0x05, 0x27, 0xC8, 0xA5, 0x00, 0x02, 0x07, 0x00, 0x07, 0x10, 0x20,
+	0x47, 0xF1, 0x02, 0x04, 0x00, 0x07, 0x04, 0x02, 0x03, 0x6B, 0x40, 0x05, 0x01, 0x01, 0x05, 0xF8,
+	0x07, 0x02, 0x02, 0x02, 0xF0, 0x01, 0x09, 0x01, 0x05, 0x08, 0x44, 0x22, 0x11, 0x08, 0x80, 0x01,
+	0x08, 0x01, 0x05, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0x01, 0x08, 0x01, 0x05, 0x61, 0x08, 0x42, 0x10,
+	0x9F, 0x01, 0x08, 0x01, 0x05, 0x74, 0x42, 0x22, 0x22, 0x3F, 0x01, 0x08, 0x01, 0x05, 0x74, 0x42,
+	0x60, 0x86, 0x2E, 0x01, 0x08, 0x01, 0x06, 0x18, 0xA2, 0x92, 0x8B, 0xF0, 0x87, 0x01, 0x08, 0x01,
+	0x05, 0x7A, 0x10, 0xE0, 0x86, 0x2E, 0x01, 0x08, 0x01, 0x05, 0x3A, 0x21, 0xE8, 0xC6, 0x2E, 0x01,
+	0x08, 0x01, 0x05, 0xFC, 0x42, 0x21, 0x08, 0x84, 0x01, 0x08, 0x01, 0x05, 0x74, 0x62, 0xE8, 0xC6,
+	0x2E, 0x01, 0x08, 0x01, 0x05, 0x74, 0x63, 0x17, 0x84, 0x5C, 0x03, 0x06, 0x02, 0x02, 0xF0, 0xF0,
+	0x03, 0x07, 0x02, 0x03, 0x6C, 0x07, 0xA0, 0x02, 0x07, 0x00, 0x06, 0x0C, 0x46, 0x20, 0x60, 0x40,
+	0xC0, 0x04, 0x03, 0x01, 0x05, 0xF8, 0x3E, 0x02, 0x07, 0x00, 0x06, 0xC0, 0x81, 0x81, 0x18, 0x8C,
+	0x00, 0x02, 0x07, 0x02, 0x04, 0x69, 0x12, 0x40, 0xC0, 0x00, 0x0A, 0x01, 0x05, 0x74, 0x63, 0x3A,
+	0xD6, 0x70, 0x8B, 0x80, 0x01, 0x08, 0x00, 0x07, 0x30, 0x20, 0xA1, 0x42, 0x8F, 0x91, 0x77, 0x01,
+	0x08, 0x00, 0x06, 0xF9, 0x14, 0x5E, 0x45, 0x14, 0x7E, 0x01, 0x08, 0x01, 0x05, 0x7C, 0x61, 0x08,
+	0x42, 0x2E, 0x01, 0x08, 0x00, 0x06, 0xF1, 0x24, 0x51, 0x45, 0x14, 0xBC, 0x01, 0x08, 0x00, 0x06,
+	0xFD, 0x15, 0x1C, 0x51, 0x04, 0x7F, 0x01, 0x08, 0x01, 0x06, 0xFD, 0x15, 0x1C, 0x51, 0x04, 0x38,
+	0x01, 0x08, 0x01, 0x06, 0x7A, 0x28, 0x20, 0x9E, 0x28, 0x9C, 0x01, 0x08, 0x00, 0x07, 0xEE, 0x89,
+	0x13, 0xE4, 0x48, 0x91, 0x77, 0x01, 0x08, 0x01, 0x05, 0xF9, 0x08, 0x42, 0x10, 0x9F, 0x01, 0x08,
+	0x01, 0x05, 0x78, 0x84, 0x29, 0x4A, 0x4C, 0x01, 0x08, 0x00, 0x07, 0xEE, 0x89, 0x22, 0x87, 0x09,
+	0x11, 0x73, 0x01, 0x08, 0x01, 0x05, 0xE2, 0x10, 0x84, 0x25, 0x3F, 0x01, 0x08, 0x00, 0x07, 0xEE,
+	0xD9, 0xB2, 0xA5, 0x48, 0x91, 0x77, 0x01, 0x08, 0x00, 0x07, 0xEE, 0xC9, 0x92, 0xA5, 0x4A, 0x93,
+	0x76, 0x01, 0x08, 0x01, 0x05, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0x01, 0x08, 0x01, 0x05, 0xF2, 0x52,
+	0x97, 0x21, 0x1C, 0x01, 0x09, 0x01, 0x05, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0x38, 0x01, 0x08, 0x00,
+	0x07, 0xF8, 0x89, 0x12, 0x27, 0x89, 0x11, 0x71, 0x01, 0x08, 0x01, 0x05, 0x6C, 0xE0, 0xE0, 0x87,
+	0x36, 0x01, 0x08, 0x00, 0x07, 0xFF, 0x24, 0x40, 0x81, 0x02, 0x04, 0x1C, 0x01, 0x08, 0x00, 0x07,
+	0xEE, 0x89, 0x12, 0x24, 0x48, 0x91, 0x1C, 0x01, 0x08, 0x00, 0x07, 0xEE, 0x89, 0x11, 0x42, 0x85,
+	0x04, 0x08, 0x01, 0x08, 0x00, 0x07, 0xEE, 0x89, 0x12, 0xA5, 0x4A, 0x95, 0x14, 0x01, 0x08, 0x00,
+	0x07, 0xC6, 0x88, 0xA0, 0x81, 0x05, 0x11, 0x63, 0x01, 0x08, 0x00, 0x07, 0xEE, 0x88, 0xA1, 0x41,
+	0x02, 0x04, 0x1C, 0x01, 0x08, 0x01, 0x05, 0xFC, 0x44, 0x42, 0x22, 0x3F, 0x01, 0x0A, 0x02, 0x03,
+	0xF2, 0x49, 0x24, 0x9C, 0x01, 0x09, 0x01, 0x04, 0x84, 0x44, 0x22, 0x11, 0x10, 0x01, 0x0A, 0x02,
+	0x03, 0xE4, 0x92, 0x49, 0x3C, 0x01, 0x04, 0x01, 0x05, 0x21, 0x15, 0x10, 0x0B, 0x01, 0x00, 0x07,
+	0xFE, 0x01, 0x02, 0x03, 0x02, 0x90, 0x03, 0x06, 0x01, 0x06, 0x72, 0x27, 0xA2, 0x89, 0xF0, 0x01,
+	0x08, 0x00, 0x06, 0xC1, 0x05, 0x99, 0x45, 0x14, 0x7E, 0x03, 0x06, 0x01, 0x05, 0x7C, 0x61, 0x08,
+	0xB8, 0x01, 0x08, 0x01, 0x06, 0x18, 0x26, 0xA6, 0x8A, 0x28, 0x9F, 0x03, 0x06, 0x01, 0x05, 0x74,
+	0x7F, 0x08, 0x3C, 0x01, 0x08, 0x01, 0x05, 0x3A, 0x3E, 0x84, 0x21, 0x1F, 0x03, 0x08, 0x01, 0x06,
+	0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x9C, 0x01, 0x08, 0x00, 0x07, 0xC0, 0x81, 0x63, 0x24, 0x48, 0x91,
+	0x77, 0x01, 0x08, 0x01, 0x05, 0x20, 0x38, 0x42, 0x10, 0x9F, 0x01, 0x0A, 0x01, 0x04, 0x20, 0xF1,
+	0x11, 0x11, 0x1E, 0x01, 0x08, 0x00, 0x06, 0xC1, 0x05, 0xD2, 0x71, 0x44, 0xB7, 0x01, 0x08, 0x01,
+	0x05, 0x61, 0x08, 0x42, 0x10, 0x9F, 0x03, 0x06, 0x00, 0x07, 0xE8, 0xA9, 0x52, 0xA5, 0x5F, 0xC0,
+	0x03, 0x06, 0x00, 0x07, 0xD8, 0xC9, 0x12, 0x24, 0x5D, 0xC0, 0x03, 0x06, 0x01, 0x05, 0x74, 0x63,
+	0x18, 0xB8, 0x03, 0x08, 0x00, 0x06, 0xD9, 0x94, 0x51, 0x45, 0xE4, 0x38, 0x03, 0x08, 0x01, 0x06,
+	0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x87, 0x03, 0x06, 0x01, 0x05, 0xDB, 0x10, 0x84, 0x7C, 0x03, 0x06,
+	0x01, 0x05, 0x7C, 0x5C, 0x18, 0xF8, 0x02, 0x07, 0x01, 0x06, 0x43, 0xE4, 0x10, 0x41, 0x13, 0x80,
+	0x03, 0x06, 0x00, 0x07, 0xCC, 0x89, 0x12, 0x24, 0xC6, 0xC0, 0x03, 0x06, 0x00, 0x07, 0xEE, 0x89,
+	0x11, 0x42, 0x82, 0x00, 0x03, 0x06, 0x00, 0x07, 0xEE, 0x89, 0x52, 0xA5, 0x45, 0x00, 0x03, 0x06,
+	0x00, 0x06, 0xCD, 0x23, 0x0C, 0x4B, 0x30, 0x03, 0x08, 0x00, 0x07, 0xEE, 0x88, 0x91, 0x41, 0x82,
+	0x04, 0x3C, 0x03, 0x06, 0x01, 0x05, 0xFC, 0x88, 0x88, 0xFC, 0x01, 0x0A, 0x02, 0x03, 0x29, 0x25,
+	0x12, 0x44, 0x01, 0x09, 0x03, 0x01, 0xFF, 0x80, 0x01, 0x0A, 0x02, 0x03, 0x89, 0x24, 0x52, 0x50,
+	0x05, 0x02, 0x01, 0x05, 0x4D, 0x80,
+};
+
+sFONT Font12 = {
+  NULL,
+  7, /* Width */
+  12, /* Height */
+  Font12_Packed,
+  Font12_Offsets,
+};
+
+#endif
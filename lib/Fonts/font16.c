@@ -42,6 +42,8 @@
 //  Font data for Courier New 12pt
 // 
 
+#ifndef FONTS_PACKED
+
 const uint8_t Font16_Table[] = 
 {
 	// @0 ' ' (11 pixels wide)
@@ -1761,4 +1763,6 @@ sFONT Font16 = {
   16, /* Height */
 };
 
+#endif
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
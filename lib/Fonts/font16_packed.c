@@ -0,0 +1,104 @@
+// generated by assets/make-packed-font.ts from font16.c
+#include "fonts.h"
+#include <stddef.h>
+
+#ifdef FONTS_PACKED
+
+const uint16_t Font16_Offsets[96] = {
+	0x0000, 0x0000, 0x0007, 0x0010, 0x001F, 0x002F, 0x003D, 0x0049, 0x004F, 0x0059, 0x0063, 0x006E,
+	0x0079, 0x007F, 0x0084, 0x0089, 0x009A, 0x00A7, 0x00B5, 0x00C2, 0x00D0, 0x00DD, 0x00EA, 0x00F7,
+	0x0104, 0x0111, 0x011E, 0x0124, 0x012D, 0x013C, 0x0144, 0x0153, 0x015F, 0x016C, 0x017C, 0x0189,
+	0x0198, 0x01A7, 0x01B4, 0x01C3, 0x01D2, 0x01E1, 0x01EE, 0x01FD, 0x020C, 0x021B, 0x022C, 0x023B,
+	0x024A, 0x0257, 0x0268, 0x0278, 0x0284, 0x0291, 0x02A0, 0x02AF, 0x02C0, 0x02CF, 0x02DF, 0x02EB,
+	0x02F5, 0x0306, 0x0310, 0x031A, 0x0320, 0x0326, 0x0331, 0x0341, 0x034C, 0x035C, 0x0368, 0x0378,
+	0x0388, 0x0398, 0x03A6, 0x03B4, 0x03C4, 0x03D2, 0x03DF, 0x03EB, 0x03F7, 0x0407, 0x0417, 0x0423,
+	0x042E, 0x043C, 0x0448, 0x0454, 0x0462, 0x046E, 0x047F, 0x048A, 0x0494, 0x049B, 0x04A5, 0x04AC,
+};
+
+const uint8_t Font16_Packed[1196] = {
+	0x01, 0x0A, 0x04, 0x02, 0xFF, 0xFF, 0x30, 0x02, 0x05, 0x03, 0x07, 0xEF, 0xDD, 0x12, 0x24, 0x40,
+	0x01, 0x0B, 0x02, 0x08, 0x36, 0x36, 0x36, 0x36, 0xFF, 0x6C, 0xFF, 0x6C, 0x6C, 0x6C, 0x6C, 0x00,
+	0x0D, 0x02, 0x07, 0x10, 0xFF, 0x1E, 0x3E, 0x0F, 0x0F, 0x07, 0xC7, 0x8F, 0xF0, 0x81, 0x00, 0x01,
+	0x0A, 0x02, 0x08, 0x60, 0x90, 0x90, 0x63, 0x1E, 0x78, 0xC6, 0x09, 0x09, 0x06, 0x02, 0x09, 0x02,
+	0x07, 0x3C, 0xC1, 0x83, 0x03, 0x0E, 0xF7, 0x66, 0x76, 0x02, 0x05, 0x05, 0x03, 0xFD, 0x24, 0x01,
+	0x0C, 0x04, 0x04, 0x33, 0x6E, 0xCC, 0xCC, 0xE6, 0x33, 0x01, 0x0C, 0x03, 0x04, 0xCC, 0x63, 0x33,
+	0x33, 0x36, 0xEC, 0x01, 0x07, 0x02, 0x08, 0x18, 0x18, 0xFF, 0xFF, 0x3C, 0x7E, 0x66, 0x03, 0x07,
+	0x02, 0x07, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00, 0x09, 0x05, 0x04, 0x03, 0x6B, 0x48, 0x06,
+	0x01, 0x02, 0x07, 0xFE, 0x09, 0x02, 0x04, 0x02, 0xF0, 0x00, 0x0D, 0x02, 0x08, 0x03, 0x03, 0x06,
+	0x06, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0x01, 0x0A, 0x02, 0x07, 0x38, 0xDB,
+	0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x6C, 0x70, 0x01, 0x0A, 0x02, 0x08, 0x18, 0xF8, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0x18, 0x18, 0xFF, 0x01, 0x0A, 0x02, 0x07, 0x3C, 0xCF, 0x1E, 0x30, 0xC3, 0x0C, 0x30,
+	0xC1, 0xFC, 0x01, 0x0A, 0x01, 0x08, 0x7E, 0xC3, 0x03, 0x06, 0x3E, 0x07, 0x03, 0x03, 0xC3, 0x7E,
+	0x01, 0x0A, 0x02, 0x07, 0x1C, 0x38, 0xF1, 0x66, 0xC9, 0xB3, 0x7F, 0x0C, 0x7C, 0x01, 0x0A, 0x02,
+	0x07, 0x7E, 0xC1, 0x83, 0x07, 0xC8, 0xC1, 0x83, 0x86, 0xF8, 0x01, 0x0A, 0x02, 0x07, 0x1E, 0xE1,
+	0x86, 0x0D, 0xDC, 0xF1, 0xE3, 0x66, 0x78, 0x01, 0x0A, 0x01, 0x07, 0xFF, 0x0C, 0x18, 0x60, 0xC1,
+	0x83, 0x0C, 0x18, 0x30, 0x01, 0x0A, 0x02, 0x07, 0x7D, 0x8F, 0x1E, 0x37, 0xD8, 0xF1, 0xE3, 0xC6,
+	0xF8, 0x01, 0x0A, 0x02, 0x07, 0x79, 0x9B, 0x1E, 0x3C, 0xEE, 0xC1, 0x86, 0x1D, 0xE0, 0x04, 0x07,
+	0x04, 0x02, 0xF0, 0x3C, 0x04, 0x09, 0x04, 0x04, 0x33, 0x00, 0x06, 0x48, 0x80, 0x02, 0x09, 0x01,
+	0x09, 0x01, 0x83, 0x02, 0x06, 0x0C, 0x01, 0x80, 0x20, 0x0C, 0x01, 0x80, 0x05, 0x03, 0x01, 0x09,
+	0xFF, 0x80, 0x3F, 0xE0, 0x02, 0x09, 0x01, 0x09, 0xC0, 0x18, 0x02, 0x00, 0xC0, 0x18, 0x30, 0x20,
+	0x60, 0xC0, 0x00, 0x02, 0x09, 0x02, 0x07, 0x7D, 0x8F, 0x18, 0x31, 0xC6, 0x0C, 0x00, 0x30, 0x01,
+	0x0B, 0x02, 0x06, 0x39, 0x18, 0x61, 0x9E, 0x9A, 0x67, 0x81, 0x13, 0x80, 0x02, 0x09, 0x01, 0x0A,
+	0x7E, 0x07, 0x81, 0x20, 0xCC, 0x33, 0x0F, 0xC6, 0x19, 0x86, 0xF3, 0xC0, 0x02, 0x09, 0x01, 0x08,
+	0xFE, 0x63, 0x63, 0x63, 0x7E, 0x63, 0x63, 0x63, 0xFE, 0x02, 0x09, 0x01, 0x09, 0x3E, 0xB0, 0xF0,
+	0x38, 0x0C, 0x06, 0x03, 0x02, 0xC2, 0x3E, 0x00, 0x02, 0x09, 0x01, 0x09, 0xFE, 0x31, 0x98, 0x6C,
+	0x36, 0x1B, 0x0D, 0x86, 0xC6, 0xFE, 0x00, 0x02, 0x09, 0x01, 0x08, 0xFF, 0x61, 0x61, 0x64, 0x7C,
+	0x64, 0x61, 0x61, 0xFF, 0x02, 0x09, 0x01, 0x09, 0xFF, 0xB0, 0x58, 0x2C, 0x87, 0xC3, 0x21, 0x80,
+	0xC0, 0xF8, 0x00, 0x02, 0x09, 0x01, 0x09, 0x3D, 0x31, 0xB0, 0x58, 0x0C, 0x06, 0x7F, 0x0C, 0xC6,
+	0x3E, 0x00, 0x02, 0x09, 0x01, 0x09, 0xF7, 0xB1, 0x98, 0xCC, 0x67, 0xF3, 0x19, 0x8C, 0xC6, 0xF7,
+	0x80, 0x02, 0x09, 0x02, 0x08, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x02, 0x09,
+	0x01, 0x09, 0x3F, 0x83, 0x01, 0x80, 0xC0, 0x66, 0x33, 0x19, 0x8C, 0x7C, 0x00, 0x02, 0x09, 0x01,
+	0x09, 0xF7, 0xB1, 0x99, 0x8D, 0x87, 0x83, 0xE1, 0x98, 0xC6, 0xF3, 0x80, 0x02, 0x09, 0x01, 0x09,
+	0xFC, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x84, 0xC2, 0x61, 0xFF, 0x80, 0x02, 0x09, 0x00, 0x0B, 0xE0,
+	0xEC, 0x19, 0xC7, 0x3D, 0xE6, 0xAC, 0xDD, 0x99, 0x33, 0x06, 0xFB, 0xE0, 0x02, 0x09, 0x01, 0x09,
+	0xE7, 0xB1, 0x9C, 0xCF, 0x66, 0xB3, 0x79, 0x9C, 0xC6, 0xF3, 0x00, 0x02, 0x09, 0x01, 0x09, 0x3E,
+	0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x00, 0x02, 0x09, 0x01, 0x08, 0xFE, 0x63,
+	0x63, 0x63, 0x63, 0x7E, 0x60, 0x60, 0xFC, 0x02, 0x0B, 0x01, 0x09, 0x3E, 0x31, 0xB0, 0x78, 0x3C,
+	0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x0C, 0xCF, 0xC0, 0x02, 0x09, 0x01, 0x0A, 0xFE, 0x18, 0xC6, 0x31,
+	0x8C, 0x7C, 0x19, 0x86, 0x31, 0x8C, 0xF9, 0xC0, 0x02, 0x09, 0x02, 0x07, 0x7F, 0x8F, 0x1F, 0x07,
+	0xC1, 0xF1, 0xE3, 0xFC, 0x02, 0x09, 0x01, 0x08, 0xFF, 0x99, 0x99, 0x99, 0x18, 0x18, 0x18, 0x18,
+	0x7E, 0x02, 0x09, 0x01, 0x09, 0xF7, 0xB1, 0x98, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xC6, 0x3E, 0x00,
+	0x02, 0x09, 0x01, 0x09, 0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x61, 0xB0, 0x50, 0x38, 0x1C, 0x00, 0x02,
+	0x09, 0x00, 0x0B, 0xFB, 0xEC, 0x19, 0x93, 0x37, 0x66, 0xEC, 0x55, 0x0E, 0xE1, 0xDC, 0x31, 0x80,
+	0x02, 0x09, 0x01, 0x09, 0xF7, 0xB1, 0x8D, 0x83, 0x81, 0xC0, 0xE0, 0xD8, 0xC6, 0xF7, 0x80, 0x02,
+	0x09, 0x01, 0x0A, 0xF3, 0xD8, 0x63, 0x30, 0x78, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0x00, 0x02,
+	0x09, 0x02, 0x07, 0xFF, 0x0E, 0x30, 0xC1, 0x06, 0x18, 0xE1, 0xFE, 0x01, 0x0C, 0x05, 0x04, 0xFC,
+	0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0x00, 0x0D, 0x02, 0x08, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18,
+	0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x0C, 0x03, 0x04, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x3F,
+	0x00, 0x06, 0x02, 0x07, 0x10, 0x50, 0xA2, 0x28, 0x30, 0x40, 0x0F, 0x01, 0x00, 0x0B, 0xFF, 0xE0,
+	0x00, 0x03, 0x04, 0x03, 0x88, 0x80, 0x04, 0x07, 0x02, 0x08, 0x7C, 0x06, 0x06, 0x7E, 0xC6, 0xCE,
+	0x77, 0x01, 0x0A, 0x01, 0x09, 0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x0D, 0x86, 0xC3, 0x73, 0x77,
+	0x00, 0x04, 0x07, 0x01, 0x08, 0x3D, 0x63, 0xC1, 0xC0, 0xC1, 0x63, 0x3E, 0x01, 0x0A, 0x01, 0x09,
+	0x07, 0x01, 0x80, 0xC7, 0x66, 0x76, 0x1B, 0x0D, 0x86, 0x67, 0x1D, 0xC0, 0x04, 0x07, 0x01, 0x09,
+	0x3E, 0x31, 0xB0, 0x7F, 0xFC, 0x03, 0x0C, 0xFC, 0x01, 0x0A, 0x02, 0x09, 0x1F, 0x98, 0x0C, 0x1F,
+	0xC3, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x7F, 0x00, 0x04, 0x0A, 0x01, 0x09, 0x3B, 0xB3, 0xB0, 0xD8,
+	0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x1F, 0x00, 0x01, 0x0A, 0x01, 0x09, 0xE0, 0x30, 0x18, 0x0D,
+	0xC7, 0x33, 0x19, 0x8C, 0xC6, 0x63, 0x7B, 0xC0, 0x01, 0x0A, 0x02, 0x08, 0x18, 0x18, 0x00, 0x78,
+	0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x01, 0x0D, 0x02, 0x06, 0x18, 0x60, 0x3F, 0x0C, 0x30, 0xC3,
+	0x0C, 0x30, 0xC3, 0xF8, 0x01, 0x0A, 0x01, 0x09, 0xE0, 0x30, 0x18, 0x0D, 0xE6, 0xC3, 0xC1, 0xE0,
+	0xD8, 0x66, 0x77, 0xC0, 0x01, 0x0A, 0x02, 0x08, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+	0x18, 0xFF, 0x04, 0x07, 0x01, 0x0A, 0xFF, 0x1B, 0x66, 0xD9, 0xB6, 0x6D, 0x9B, 0x6E, 0xDC, 0x04,
+	0x07, 0x01, 0x09, 0xEE, 0x39, 0x98, 0xCC, 0x66, 0x33, 0x1B, 0xDE, 0x04, 0x07, 0x01, 0x09, 0x3E,
+	0x31, 0xB0, 0x78, 0x3C, 0x1B, 0x18, 0xF8, 0x04, 0x0A, 0x01, 0x09, 0xEE, 0x39, 0x98, 0x6C, 0x36,
+	0x1B, 0x99, 0xB8, 0xC0, 0x60, 0x7C, 0x00, 0x04, 0x0A, 0x01, 0x09, 0x3B, 0xB3, 0xB0, 0xD8, 0x6C,
+	0x33, 0x38, 0xEC, 0x06, 0x03, 0x07, 0xC0, 0x04, 0x07, 0x01, 0x09, 0xF7, 0x1C, 0xCC, 0x06, 0x03,
+	0x01, 0x83, 0xF8, 0x04, 0x07, 0x02, 0x07, 0x7F, 0x8F, 0xC3, 0xE0, 0xF8, 0xFF, 0x00, 0x01, 0x0A,
+	0x01, 0x08, 0x30, 0x30, 0x30, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x31, 0x1E, 0x04, 0x07, 0x01, 0x09,
+	0xE7, 0x31, 0x98, 0xCC, 0x66, 0x33, 0x38, 0xEE, 0x04, 0x07, 0x01, 0x09, 0xF7, 0xB1, 0x98, 0xC6,
+	0xC3, 0x60, 0xE0, 0x70, 0x04, 0x07, 0x00, 0x0B, 0xF1, 0xEC, 0x19, 0x93, 0x37, 0x63, 0xB8, 0x77,
+	0x0C, 0x60, 0x04, 0x07, 0x01, 0x09, 0xF7, 0x9B, 0x07, 0x03, 0x81, 0xC1, 0xB3, 0xDE, 0x04, 0x0A,
+	0x01, 0x0A, 0xF3, 0xD8, 0x63, 0x30, 0xCC, 0x16, 0x07, 0x80, 0xC0, 0x30, 0x18, 0x1F, 0x00, 0x04,
+	0x07, 0x02, 0x07, 0xFF, 0x0C, 0x31, 0xC6, 0x18, 0x7F, 0x80, 0x01, 0x0C, 0x03, 0x04, 0x36, 0x66,
+	0x66, 0xC6, 0x66, 0x63, 0x01, 0x0C, 0x05, 0x02, 0xFF, 0xFF, 0xFF, 0x01, 0x0C, 0x04, 0x04, 0xC6,
+	0x66, 0x66, 0x36, 0x66, 0x6C, 0x05, 0x03, 0x02, 0x07, 0x61, 0x24, 0x30,
+};
+
+sFONT Font16 = {
+  NULL,
+  11, /* Width */
+  16, /* Height */
+  Font16_Packed,
+  Font16_Offsets,
+};
+
+#endif
@@ -39,6 +39,8 @@
 #include "fonts.h"
 
 // Character bitmaps for Courier New 15pt
+#ifndef FONTS_PACKED
+
 const uint8_t Font20_Table[] = 
 {
 	// @0 ' ' (14 pixels wide)
@@ -2139,4 +2141,6 @@ sFONT Font20 = {
   20, /* Height */
 };
 
+#endif
+
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,130 @@
+// generated by assets/make-packed-font.ts from font20.c
+#include "fonts.h"
+#include <stddef.h>
+
+#ifdef FONTS_PACKED
+
+const uint16_t Font20_Offsets[96] = {
+	0x0000, 0x0000, 0x0009, 0x0013, 0x002B, 0x003F, 0x0052, 0x0063, 0x006A, 0x0076, 0x0082, 0x008F,
+	0x00A0, 0x00A7, 0x00AE, 0x00B4, 0x00C8, 0x00DB, 0x00EC, 0x00FF, 0x0114, 0x0127, 0x013A, 0x014D,
+	0x0160, 0x0173, 0x0186, 0x018E, 0x0199, 0x01AD, 0x01BA, 0x01CE, 0x01DE, 0x01EF, 0x0205, 0x0218,
+	0x022B, 0x0240, 0x0253, 0x0266, 0x027B, 0x028E, 0x029E, 0x02B3, 0x02C8, 0x02DB, 0x02F1, 0x0304,
+	0x0317, 0x032A, 0x0341, 0x0356, 0x0369, 0x037C, 0x038F, 0x03A4, 0x03BC, 0x03D1, 0x03E4, 0x03F4,
+	0x0400, 0x0414, 0x0420, 0x042B, 0x0433, 0x0439, 0x0449, 0x045F, 0x046F, 0x0485, 0x0495, 0x04A8,
+	0x04BE, 0x04D3, 0x04E4, 0x04F9, 0x050E, 0x051F, 0x0531, 0x0541, 0x0551, 0x0567, 0x057D, 0x058D,
+	0x059A, 0x05AD, 0x05BD, 0x05CE, 0x05DF, 0x05EF, 0x0605, 0x0612, 0x0622, 0x062A, 0x063A, 0x0643,
+};
+
+const uint8_t Font20_Packed[1603] = {
+	0x01, 0x0D, 0x05, 0x03, 0xFF, 0xFF, 0xFA, 0x40, 0x7E, 0x02, 0x06, 0x03, 0x08, 0xE7, 0xE7, 0xE7,
+	0x42, 0x42, 0x42, 0x00, 0x10, 0x02, 0x0A, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x3F, 0xFF, 0xFC,
+	0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x00, 0x10, 0x03, 0x08, 0x18,
+	0x18, 0x3F, 0x7F, 0xC3, 0xC0, 0xF8, 0x7E, 0x07, 0xC3, 0xC3, 0xFE, 0xFC, 0x18, 0x18, 0x18, 0x01,
+	0x0D, 0x02, 0x09, 0x70, 0x44, 0x22, 0x11, 0x07, 0x18, 0x3C, 0xF9, 0xE0, 0xC7, 0x04, 0x42, 0x21,
+	0x10, 0x70, 0x03, 0x0B, 0x03, 0x09, 0x1F, 0x3F, 0x98, 0x0C, 0x03, 0x03, 0xCF, 0xFF, 0x9E, 0xC6,
+	0x7F, 0xCF, 0x60, 0x02, 0x06, 0x06, 0x03, 0xFF, 0xA4, 0x80, 0x01, 0x10, 0x06, 0x04, 0x33, 0x66,
+	0x6C, 0xCC, 0xCC, 0xC6, 0x66, 0x33, 0x01, 0x10, 0x04, 0x04, 0xCC, 0x66, 0x63, 0x33, 0x33, 0x36,
+	0x66, 0xCC, 0x01, 0x09, 0x03, 0x08, 0x18, 0x18, 0x18, 0xDB, 0xFF, 0x3C, 0x3C, 0x7E, 0x66, 0x03,
+	0x0A, 0x02, 0x0A, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+	0x0B, 0x06, 0x05, 0x04, 0x76, 0x6C, 0xC8, 0x07, 0x02, 0x02, 0x09, 0xFF, 0xFF, 0xC0, 0x0B, 0x03,
+	0x06, 0x03, 0xFF, 0x80, 0x00, 0x10, 0x03, 0x08, 0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18,
+	0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC0, 0x01, 0x0D, 0x02, 0x09, 0x3E, 0x3F, 0x98, 0xD8,
+	0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8, 0xCF, 0xE3, 0xE0, 0x01, 0x0D, 0x03, 0x08, 0x18,
+	0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x01, 0x0D, 0x02, 0x09,
+	0x3E, 0x3F, 0xB8, 0xF8, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0xFF, 0xF8, 0x01,
+	0x0D, 0x01, 0x0A, 0x1F, 0x1F, 0xE6, 0x1C, 0x03, 0x01, 0xC3, 0xE0, 0xF8, 0x07, 0x00, 0xC0, 0x3C,
+	0x1F, 0xFE, 0x7F, 0x00, 0x01, 0x0D, 0x02, 0x09, 0x07, 0x07, 0x83, 0xC3, 0x63, 0x31, 0x99, 0x8D,
+	0x86, 0xFF, 0xFF, 0xC0, 0xC1, 0xF0, 0xF8, 0x01, 0x0D, 0x02, 0x09, 0x7F, 0x3F, 0x98, 0x0C, 0x07,
+	0xE3, 0xF9, 0x8E, 0x03, 0x01, 0x80, 0xF0, 0xFF, 0xE7, 0xE0, 0x01, 0x0D, 0x02, 0x09, 0x0F, 0x9F,
+	0xDE, 0x0C, 0x0E, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xD8, 0xEF, 0xE1, 0xE0, 0x01, 0x0D, 0x02,
+	0x09, 0xFF, 0xFF, 0xF0, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x80, 0xC0,
+	0x01, 0x0D, 0x02, 0x09, 0x3E, 0x3F, 0xB8, 0xF8, 0x3E, 0x3B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8,
+	0xEF, 0xE3, 0xE0, 0x01, 0x0D, 0x02, 0x09, 0x3C, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B,
+	0x03, 0x81, 0x83, 0xDF, 0xCF, 0x80, 0x05, 0x09, 0x06, 0x03, 0xFF, 0x80, 0x3F, 0xE0, 0x05, 0x0B,
+	0x05, 0x05, 0x39, 0xCE, 0x00, 0x01, 0xCC, 0xC6, 0x20, 0x03, 0x0B, 0x01, 0x0B, 0x00, 0x60, 0x3C,
+	0x1E, 0x07, 0x03, 0x81, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0x80, 0x3C, 0x01, 0x80, 0x05, 0x06, 0x01,
+	0x0B, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x03, 0x0B, 0x02, 0x0B, 0xC0, 0x1E,
+	0x00, 0xF0, 0x07, 0x00, 0x38, 0x03, 0xC0, 0xE0, 0x70, 0x3C, 0x1E, 0x03, 0x00, 0x00, 0x02, 0x0C,
+	0x03, 0x08, 0x7C, 0xFE, 0xC3, 0xC3, 0x03, 0x0E, 0x1C, 0x18, 0x00, 0x00, 0x38, 0x38, 0x01, 0x0E,
+	0x03, 0x07, 0x1C, 0xC9, 0x0C, 0x18, 0x31, 0xE4, 0xC9, 0x93, 0x1E, 0x02, 0x04, 0x27, 0x80, 0x02,
+	0x0C, 0x01, 0x0C, 0x3F, 0x03, 0xF0, 0x07, 0x00, 0xD8, 0x0D, 0x81, 0x98, 0x18, 0xC3, 0xFC, 0x3F,
+	0xC6, 0x06, 0xF0, 0xFF, 0x0F, 0x02, 0x0C, 0x02, 0x0A, 0xFE, 0x3F, 0xC6, 0x19, 0x86, 0x63, 0x9F,
+	0xC7, 0xF9, 0x87, 0x60, 0xD8, 0x3F, 0xFF, 0xFE, 0x02, 0x0C, 0x02, 0x0A, 0x1E, 0xCF, 0xF7, 0x1F,
+	0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0xDC, 0x73, 0xF8, 0x7C, 0x02, 0x0C, 0x01, 0x0B, 0xFF,
+	0x1F, 0xF1, 0x87, 0x30, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x03, 0x60, 0xEC, 0x3B, 0xFE, 0x7F, 0x80,
+	0x02, 0x0C, 0x02, 0x0A, 0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0xD8,
+	0x3F, 0xFF, 0xFF, 0x02, 0x0C, 0x02, 0x0A, 0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1,
+	0x98, 0x60, 0x18, 0x0F, 0xC3, 0xF0, 0x02, 0x0C, 0x02, 0x0B, 0x1E, 0xCF, 0xF9, 0x87, 0x60, 0x6C,
+	0x01, 0x80, 0x31, 0xFE, 0x3F, 0xC0, 0xCC, 0x19, 0xFF, 0x0F, 0x80, 0x02, 0x0C, 0x02, 0x0A, 0xF3,
+	0xFC, 0xF6, 0x19, 0x86, 0x61, 0x9F, 0xE7, 0xF9, 0x86, 0x61, 0x98, 0x6F, 0x3F, 0xCF, 0x02, 0x0C,
+	0x03, 0x08, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x02, 0x0C,
+	0x02, 0x0B, 0x0F, 0xE1, 0xFC, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x30, 0x66, 0x0C, 0xC1, 0x98, 0x73,
+	0xFC, 0x1F, 0x00, 0x02, 0x0C, 0x02, 0x0B, 0xFB, 0xFF, 0x7D, 0x8E, 0x33, 0x06, 0xC0, 0xF8, 0x1D,
+	0x83, 0x18, 0x63, 0x0C, 0x33, 0xE7, 0xFC, 0x70, 0x02, 0x0C, 0x02, 0x0A, 0xFC, 0x3F, 0x03, 0x00,
+	0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0x30, 0xCC, 0x3F, 0xFF, 0xFF, 0x02, 0x0C, 0x01, 0x0C, 0xF0,
+	0xFF, 0x0F, 0x70, 0xE7, 0x9E, 0x69, 0x66, 0xF6, 0x6F, 0x66, 0x66, 0x66, 0x66, 0x06, 0xF9, 0xFF,
+	0x9F, 0x02, 0x0C, 0x02, 0x0A, 0xE7, 0xFD, 0xF7, 0x19, 0xE6, 0x79, 0x9B, 0x66, 0xD9, 0x9E, 0x67,
+	0x98, 0xEF, 0xBB, 0xE6, 0x02, 0x0C, 0x02, 0x0A, 0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C,
+	0x0F, 0x03, 0xE1, 0xDC, 0xE3, 0xF0, 0x78, 0x02, 0x0C, 0x02, 0x0A, 0xFF, 0x3F, 0xE6, 0x1D, 0x83,
+	0x60, 0xD8, 0x77, 0xF9, 0xFC, 0x60, 0x18, 0x0F, 0xC3, 0xF0, 0x02, 0x0F, 0x02, 0x0A, 0x1E, 0x0F,
+	0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC, 0xE3, 0xF0, 0x78, 0x1E, 0xCF, 0xF3,
+	0x38, 0x02, 0x0C, 0x02, 0x0B, 0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x66, 0x1C, 0xFF, 0x1F, 0xC3, 0x1C,
+	0x61, 0x8C, 0x3B, 0xE3, 0xFC, 0x30, 0x02, 0x0C, 0x02, 0x0A, 0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xE0,
+	0x1F, 0x81, 0xF8, 0x07, 0xC0, 0xF8, 0x7F, 0xFB, 0x7C, 0x02, 0x0C, 0x02, 0x0A, 0xFF, 0xFF, 0xFC,
+	0xCF, 0x33, 0xCC, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xF0, 0xFC, 0x02, 0x0C, 0x02, 0x0A,
+	0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9C, 0xE3, 0xF0, 0x78, 0x02,
+	0x0C, 0x01, 0x0B, 0xF1, 0xFE, 0x3D, 0x83, 0x30, 0x63, 0x18, 0x63, 0x06, 0xC0, 0xD8, 0x1B, 0x01,
+	0xC0, 0x38, 0x07, 0x00, 0x02, 0x0C, 0x01, 0x0D, 0xF8, 0xFF, 0xC7, 0xD8, 0x0C, 0xCE, 0x66, 0x73,
+	0x33, 0x99, 0xB6, 0xC5, 0xB4, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x60, 0xC0, 0x02, 0x0C, 0x01, 0x0B,
+	0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC1, 0xB0, 0x1C, 0x03, 0x80, 0xD8, 0x31, 0x8C, 0x1B, 0xC7, 0xF8,
+	0xF0, 0x02, 0x0C, 0x02, 0x0A, 0xF3, 0xFC, 0xF6, 0x18, 0xCC, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C,
+	0x03, 0x03, 0xF0, 0xFC, 0x02, 0x0C, 0x03, 0x08, 0xFF, 0xFF, 0xC3, 0xC6, 0x0C, 0x18, 0x18, 0x30,
+	0x63, 0xC3, 0xFF, 0xFF, 0x01, 0x10, 0x06, 0x04, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF,
+	0x00, 0x10, 0x03, 0x08, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06,
+	0x06, 0x06, 0x03, 0x03, 0x01, 0x10, 0x04, 0x04, 0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF,
+	0x01, 0x06, 0x02, 0x09, 0x08, 0x0E, 0x0D, 0x8C, 0x6C, 0x1C, 0x04, 0x12, 0x02, 0x00, 0x0E, 0xFF,
+	0xFF, 0xFF, 0xF0, 0x01, 0x03, 0x05, 0x04, 0x86, 0x10, 0x05, 0x09, 0x02, 0x0A, 0x3F, 0x1F, 0xE0,
+	0x18, 0xFE, 0x7F, 0xB8, 0x6C, 0x3B, 0xFF, 0x7D, 0xC0, 0x01, 0x0D, 0x01, 0x0B, 0xE0, 0x1C, 0x01,
+	0x80, 0x30, 0x06, 0xF0, 0xFF, 0x9C, 0x33, 0x03, 0x60, 0x6C, 0x0D, 0xC3, 0x7F, 0xEE, 0xF0, 0x05,
+	0x09, 0x02, 0x0A, 0x1E, 0xDF, 0xF6, 0x0F, 0x03, 0xC0, 0x30, 0x0E, 0x0D, 0xFF, 0x3F, 0x00, 0x01,
+	0x0D, 0x02, 0x0B, 0x01, 0xC0, 0x38, 0x03, 0x00, 0x61, 0xEC, 0xFF, 0x98, 0x76, 0x06, 0xC0, 0xD8,
+	0x1B, 0x87, 0x3F, 0xF1, 0xEE, 0x05, 0x09, 0x02, 0x0A, 0x1E, 0x1F, 0xE6, 0x1B, 0xFF, 0xFF, 0xF0,
+	0x06, 0x0D, 0xFF, 0x1F, 0x00, 0x01, 0x0D, 0x03, 0x09, 0x1F, 0x9F, 0xCC, 0x06, 0x0F, 0xF7, 0xF8,
+	0xC0, 0x60, 0x30, 0x18, 0x0C, 0x1F, 0xEF, 0xF0, 0x05, 0x0D, 0x02, 0x0B, 0x1E, 0xEF, 0xFD, 0x87,
+	0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E, 0xC0, 0x18, 0x07, 0x1F, 0xC3, 0xF0, 0x01, 0x0D,
+	0x02, 0x0A, 0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x1F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B,
+	0xCF, 0xF3, 0xC0, 0x01, 0x0D, 0x03, 0x08, 0x18, 0x18, 0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18,
+	0x18, 0x18, 0xFF, 0xFF, 0x01, 0x11, 0x02, 0x08, 0x0C, 0x0C, 0x00, 0x00, 0x7F, 0x7F, 0x03, 0x03,
+	0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0xFE, 0xFC, 0x01, 0x0D, 0x02, 0x0A, 0xE0, 0x38, 0x06,
+	0x01, 0x80, 0x6F, 0x9B, 0xE6, 0xC1, 0xE0, 0x78, 0x1B, 0x06, 0x63, 0x9F, 0xE7, 0xC0, 0x01, 0x0D,
+	0x03, 0x08, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x05,
+	0x09, 0x01, 0x0C, 0xFD, 0xCF, 0xFE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6F, 0x77, 0xF7,
+	0x70, 0x05, 0x09, 0x02, 0x0A, 0xEF, 0x3F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3,
+	0xC0, 0x05, 0x09, 0x02, 0x0A, 0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0xFE, 0x1E,
+	0x00, 0x05, 0x0D, 0x01, 0x0B, 0xEF, 0x1F, 0xF9, 0xC3, 0x30, 0x36, 0x06, 0xC0, 0xDC, 0x33, 0xFE,
+	0x6F, 0x0C, 0x01, 0x80, 0x7C, 0x0F, 0x80, 0x05, 0x0D, 0x02, 0x0B, 0x1E, 0xEF, 0xFD, 0x87, 0x60,
+	0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E, 0xC0, 0x18, 0x03, 0x01, 0xF0, 0x3E, 0x05, 0x09, 0x02,
+	0x0A, 0xF3, 0xBD, 0xF3, 0xCC, 0xE0, 0x30, 0x0C, 0x03, 0x03, 0xFC, 0xFF, 0x00, 0x05, 0x09, 0x03,
+	0x08, 0x3F, 0xFF, 0xC3, 0xF0, 0x7E, 0x0F, 0xC3, 0xFF, 0xFC, 0x02, 0x0C, 0x02, 0x0A, 0x30, 0x0C,
+	0x03, 0x03, 0xFE, 0xFF, 0x8C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x33, 0xFC, 0x7C, 0x05, 0x09, 0x02,
+	0x0A, 0xE3, 0xB8, 0xE6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x39, 0xFF, 0x3D, 0xC0, 0x05, 0x09, 0x01,
+	0x0B, 0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x06, 0xC0, 0x70, 0x0E, 0x00, 0x05, 0x09,
+	0x01, 0x0B, 0xF1, 0xFE, 0x3D, 0x93, 0x32, 0x66, 0xFC, 0x77, 0x0E, 0xE1, 0x8C, 0x31, 0x80, 0x05,
+	0x09, 0x02, 0x0A, 0xF3, 0xFC, 0xF3, 0x30, 0x78, 0x0C, 0x07, 0x83, 0x33, 0xCF, 0xF3, 0xC0, 0x05,
+	0x0D, 0x01, 0x0B, 0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x07, 0xC0, 0x70, 0x0C, 0x01,
+	0x80, 0x60, 0x7F, 0x0F, 0xE0, 0x05, 0x09, 0x03, 0x08, 0xFF, 0xFF, 0xC6, 0x0C, 0x18, 0x30, 0x63,
+	0xFF, 0xFF, 0x01, 0x10, 0x04, 0x06, 0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x1C, 0xE1, 0xC3, 0x0C, 0x30,
+	0xC3, 0xC7, 0x01, 0x10, 0x06, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x10, 0x03, 0x06, 0xE3, 0xC3,
+	0x0C, 0x30, 0xC3, 0x0E, 0x1C, 0xE3, 0x0C, 0x30, 0xCF, 0x38, 0x06, 0x04, 0x02, 0x0A, 0x38, 0x3F,
+	0x3C, 0xFC, 0x1E,
+};
+
+sFONT Font20 = {
+  NULL,
+  14, /* Width */
+  20, /* Height */
+  Font20_Packed,
+  Font20_Offsets,
+};
+
+#endif
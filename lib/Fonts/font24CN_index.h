@@ -0,0 +1,36 @@
+#ifndef FONT24CN_INDEX
+#define FONT24CN_INDEX
+// generated by assets/make-cn-font-index.ts from font24CN.c
+const CH_CN_INDEX Font24CN_Index[30] = {
+	{0x4100, 19},
+	{0x6100, 20},
+	{0x6200, 21},
+	{0x6300, 22},
+	{0xB4CB, 6},
+	{0xB5C4, 12},
+	{0xB5E3, 13},
+	{0xB5E7, 25},
+	{0xB6D4, 10},
+	{0xBAC3, 1},
+	{0xBADA, 5},
+	{0xBBB6, 27},
+	{0xC4E3, 0},
+	{0xC5C9, 18},
+	{0xC8ED, 3},
+	{0xCAB9, 29},
+	{0xCAF7, 16},
+	{0xCCE5, 8},
+	{0xCEA2, 2},
+	{0xCEAA, 15},
+	{0xCFC2, 9},
+	{0xD1A9, 24},
+	{0xD1C5, 4},
+	{0xD3A6, 11},
+	{0xD3AD, 28},
+	{0xD3C3, 30},
+	{0xD5F3, 14},
+	{0xD7D3, 26},
+	{0xD7D6, 7},
+	{0xDDAE, 17},
+};
+#endif
@@ -0,0 +1,164 @@
+// generated by assets/make-packed-font.ts from font24.c
+#include "fonts.h"
+#include <stddef.h>
+
+#ifdef FONTS_PACKED
+
+const uint16_t Font24_Offsets[96] = {
+	0x0000, 0x0000, 0x000A, 0x0015, 0x002F, 0x0049, 0x0060, 0x0076, 0x007D, 0x008F, 0x00A1, 0x00B2,
+	0x00C8, 0x00D1, 0x00D8, 0x00DE, 0x00FB, 0x0112, 0x0129, 0x0142, 0x0159, 0x0172, 0x018B, 0x01A2,
+	0x01B9, 0x01D0, 0x01E7, 0x01F1, 0x01FF, 0x021A, 0x0228, 0x0243, 0x0257, 0x0271, 0x0291, 0x02AC,
+	0x02C5, 0x02E0, 0x02F9, 0x0312, 0x032D, 0x034A, 0x0360, 0x037B, 0x039A, 0x03B5, 0x03D5, 0x03F2,
+	0x040B, 0x0424, 0x0442, 0x045F, 0x0475, 0x048E, 0x04AB, 0x04CA, 0x04EC, 0x0509, 0x0526, 0x053E,
+	0x054E, 0x056B, 0x057B, 0x058A, 0x0592, 0x0599, 0x05AE, 0x05CB, 0x05E0, 0x05FD, 0x0612, 0x062D,
+	0x064B, 0x066A, 0x0685, 0x06A0, 0x06BB, 0x06D6, 0x06F0, 0x0708, 0x071D, 0x073B, 0x0759, 0x076E,
+	0x0780, 0x079B, 0x07B3, 0x07CB, 0x07E1, 0x07F6, 0x0818, 0x082A, 0x083C, 0x0845, 0x0857, 0x0862,
+};
+
+const uint8_t Font24_Packed[2146] = {
+	0x02, 0x0F, 0x06, 0x03, 0xFF, 0xFF, 0xFF, 0xE9, 0x01, 0xF8, 0x03, 0x07, 0x04, 0x08, 0xE7, 0xE7,
+	0xE7, 0x42, 0x42, 0x42, 0x42, 0x02, 0x10, 0x02, 0x0B, 0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x99,
+	0xFF, 0xFF, 0xF8, 0xCC, 0x33, 0x1F, 0xFF, 0xFF, 0x99, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x98, 0x01,
+	0x13, 0x03, 0x09, 0x0C, 0x06, 0x0F, 0x6F, 0xFC, 0x3E, 0x1F, 0x80, 0xF8, 0x3F, 0x03, 0xF0, 0x7C,
+	0x3E, 0x3F, 0xFB, 0x78, 0x18, 0x0C, 0x06, 0x03, 0x00, 0x02, 0x0F, 0x03, 0x0A, 0x3C, 0x1F, 0x8E,
+	0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xFC, 0xFC, 0xFF, 0x8E, 0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xE0, 0xF0,
+	0x04, 0x0D, 0x03, 0x0B, 0x1F, 0x87, 0xF1, 0x8C, 0x30, 0x06, 0x00, 0x60, 0x0E, 0x03, 0xE7, 0xEF,
+	0xF8, 0xF3, 0x0E, 0x3F, 0xF3, 0xEE, 0x03, 0x07, 0x06, 0x03, 0xFF, 0xA4, 0x90, 0x02, 0x12, 0x07,
+	0x06, 0x0C, 0x73, 0x9E, 0x71, 0xCE, 0x38, 0xE3, 0x8E, 0x38, 0x71, 0xC3, 0x8E, 0x1C, 0x30, 0x02,
+	0x12, 0x03, 0x06, 0xC3, 0x87, 0x1C, 0x38, 0xE1, 0xC7, 0x1C, 0x71, 0xC7, 0x38, 0xE7, 0x9C, 0xE3,
+	0x00, 0x02, 0x0A, 0x03, 0x0A, 0x0C, 0x03, 0x00, 0xC3, 0xB7, 0xFF, 0xCF, 0xC1, 0xE0, 0x78, 0x33,
+	0x0C, 0xC0, 0x04, 0x0C, 0x02, 0x0C, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF,
+	0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x0E, 0x07, 0x06, 0x05, 0x39, 0x9C, 0xC6, 0x63,
+	0x00, 0x09, 0x02, 0x03, 0x0A, 0xFF, 0xFF, 0xF0, 0x0E, 0x03, 0x06, 0x04, 0xFF, 0xF0, 0x00, 0x14,
+	0x03, 0x0A, 0x00, 0xC0, 0x30, 0x1C, 0x06, 0x03, 0x80, 0xC0, 0x30, 0x18, 0x06, 0x03, 0x00, 0xC0,
+	0x60, 0x18, 0x0C, 0x03, 0x01, 0xC0, 0x60, 0x38, 0x0C, 0x03, 0x00, 0x02, 0x0F, 0x03, 0x0A, 0x1E,
+	0x0F, 0xC6, 0x19, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x61, 0x8F,
+	0xC1, 0xE0, 0x02, 0x0F, 0x03, 0x0A, 0x04, 0x0F, 0x0F, 0xC3, 0xB0, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+	0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x3F, 0xFF, 0xFC, 0x02, 0x0F, 0x02, 0x0B, 0x1F, 0x0F, 0xFB,
+	0x83, 0x60, 0x3C, 0x06, 0x00, 0xC0, 0x30, 0x0C, 0x07, 0x01, 0xC0, 0x60, 0x18, 0x06, 0x01, 0xFF,
+	0xFF, 0xF8, 0x02, 0x0F, 0x03, 0x0A, 0x1E, 0x1F, 0xC6, 0x38, 0x06, 0x01, 0x80, 0xC1, 0xE0, 0x7C,
+	0x03, 0x80, 0x30, 0x0C, 0x03, 0xC1, 0xFF, 0xE7, 0xE0, 0x02, 0x0F, 0x02, 0x0B, 0x03, 0x80, 0xF0,
+	0x1E, 0x06, 0xC1, 0x98, 0x33, 0x0C, 0x61, 0x8C, 0x61, 0x98, 0x33, 0xFF, 0xFF, 0xF0, 0x18, 0x1F,
+	0xC3, 0xF8, 0x02, 0x0F, 0x02, 0x0B, 0x7F, 0xCF, 0xF9, 0x80, 0x30, 0x06, 0x00, 0xDE, 0x1F, 0xF3,
+	0x86, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x3C, 0x0D, 0xFF, 0x8F, 0xC0, 0x02, 0x0F, 0x03, 0x0A, 0x07,
+	0xC7, 0xF3, 0x81, 0xC0, 0x60, 0x30, 0x0D, 0xE3, 0xFE, 0xE1, 0xB0, 0x3C, 0x0F, 0x03, 0x61, 0xDF,
+	0xE1, 0xF0, 0x02, 0x0F, 0x03, 0x0A, 0xFF, 0xFF, 0xFC, 0x0F, 0x07, 0x01, 0x80, 0x60, 0x38, 0x0C,
+	0x03, 0x01, 0xC0, 0x60, 0x18, 0x0E, 0x03, 0x00, 0xC0, 0x02, 0x0F, 0x03, 0x0A, 0x3F, 0x1F, 0xEE,
+	0x1F, 0x03, 0xC0, 0xD8, 0x63, 0xF0, 0xFC, 0x61, 0xB0, 0x3C, 0x0F, 0x03, 0xE1, 0xDF, 0xE3, 0xF0,
+	0x02, 0x0F, 0x03, 0x0A, 0x3E, 0x1F, 0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x1D, 0xFF, 0x1E, 0xC0,
+	0x30, 0x18, 0x0E, 0x07, 0x3F, 0x8F, 0x80, 0x06, 0x0B, 0x06, 0x04, 0xFF, 0xF0, 0x00, 0x00, 0xFF,
+	0xF0, 0x06, 0x0D, 0x06, 0x06, 0x3C, 0xF3, 0xC0, 0x00, 0x00, 0x0E, 0x71, 0x86, 0x30, 0x80, 0x04,
+	0x0D, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x0F,
+	0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1C, 0x07, 0x06, 0x01, 0x0D, 0xFF, 0xFF,
+	0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x04, 0x0D, 0x01, 0x0E, 0xE0, 0x03, 0xC0, 0x03,
+	0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+	0x00, 0xE0, 0x00, 0x03, 0x0E, 0x03, 0x09, 0x3E, 0x3F, 0xB0, 0xF8, 0x3C, 0x18, 0x1C, 0x1C, 0x3C,
+	0x1C, 0x0C, 0x00, 0x00, 0x03, 0x81, 0xC0, 0x02, 0x11, 0x03, 0x0A, 0x1F, 0x0F, 0xE7, 0x1D, 0x83,
+	0xC3, 0xF1, 0xFC, 0xEF, 0x33, 0xCC, 0xF3, 0x3C, 0x7F, 0x0F, 0xC0, 0x18, 0x07, 0x0C, 0xFF, 0x1F,
+	0x00, 0x03, 0x0E, 0x00, 0x10, 0x1F, 0x80, 0x1F, 0xC0, 0x01, 0xC0, 0x03, 0x60, 0x03, 0x60, 0x06,
+	0x30, 0x06, 0x30, 0x0C, 0x30, 0x0F, 0xF8, 0x1F, 0xF8, 0x18, 0x0C, 0x30, 0x0C, 0xFC, 0x7F, 0xFC,
+	0x7F, 0x03, 0x0E, 0x01, 0x0D, 0xFF, 0xC7, 0xFF, 0x0C, 0x1C, 0x60, 0x63, 0x03, 0x18, 0x38, 0xFF,
+	0x87, 0xFE, 0x30, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x3F, 0xFF, 0x7F, 0xF0, 0x03, 0x0E, 0x02, 0x0C,
+	0x0F, 0xB3, 0xFF, 0x70, 0x76, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x60,
+	0x37, 0x07, 0x3F, 0xE0, 0xFC, 0x03, 0x0E, 0x01, 0x0D, 0xFF, 0x87, 0xFF, 0x0C, 0x1C, 0x60, 0x63,
+	0x01, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80, 0xCC, 0x0C, 0x60, 0xEF, 0xFE, 0x7F, 0xE0,
+	0x03, 0x0E, 0x01, 0x0C, 0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0,
+	0x33, 0x03, 0x33, 0x30, 0x33, 0x03, 0xFF, 0xFF, 0xFF, 0x03, 0x0E, 0x02, 0x0C, 0xFF, 0xFF, 0xFF,
+	0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0, 0x33, 0x03, 0x30, 0x30, 0x03, 0x00, 0xFF,
+	0x0F, 0xF0, 0x03, 0x0E, 0x02, 0x0D, 0x0F, 0xB1, 0xFF, 0x9C, 0x1C, 0xC0, 0x6C, 0x03, 0x60, 0x03,
+	0x00, 0x18, 0x7F, 0xC3, 0xFE, 0x01, 0xB8, 0x0C, 0xE0, 0xE3, 0xFF, 0x07, 0xE0, 0x03, 0x0E, 0x01,
+	0x0E, 0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0xFF, 0x0F, 0xFC, 0x30,
+	0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0xFC, 0xFF, 0xF3, 0xF0, 0x03, 0x0E, 0x03, 0x0A, 0xFF, 0xFF,
+	0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0,
+	0x03, 0x0E, 0x02, 0x0D, 0x1F, 0xF8, 0xFF, 0xC0, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x18,
+	0x18, 0xC0, 0xC6, 0x06, 0x30, 0x31, 0x83, 0x0F, 0xF8, 0x1F, 0x00, 0x03, 0x0E, 0x01, 0x0F, 0xFE,
+	0x7D, 0xFC, 0xF8, 0xC1, 0x81, 0x86, 0x03, 0x18, 0x06, 0x60, 0x0D, 0xC0, 0x1F, 0xC0, 0x39, 0xC0,
+	0x61, 0xC0, 0xC1, 0x81, 0x83, 0x8F, 0xE3, 0xFF, 0xC7, 0xC0, 0x03, 0x0E, 0x01, 0x0D, 0xFF, 0x07,
+	0xF8, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x18, 0xC0, 0xC6, 0x06,
+	0x30, 0x3F, 0xFF, 0xFF, 0xFC, 0x03, 0x0E, 0x00, 0x10, 0xF0, 0x0F, 0xF8, 0x1F, 0x38, 0x1C, 0x3C,
+	0x3C, 0x3C, 0x3C, 0x36, 0x6C, 0x36, 0x6C, 0x33, 0xCC, 0x33, 0xCC, 0x31, 0x8C, 0x30, 0x0C, 0x30,
+	0x0C, 0xFE, 0x7F, 0xFE, 0x7F, 0x03, 0x0E, 0x01, 0x0E, 0xF1, 0xFF, 0xC7, 0xF3, 0x83, 0x0F, 0x0C,
+	0x3E, 0x30, 0xD8, 0xC3, 0x73, 0x0C, 0xEC, 0x31, 0xB0, 0xC7, 0xC3, 0x0F, 0x0C, 0x1C, 0xFE, 0x33,
+	0xF8, 0xC0, 0x03, 0x0E, 0x02, 0x0C, 0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x7C, 0x03, 0xC0,
+	0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x60, 0x67, 0x0E, 0x3F, 0xC0, 0xF0, 0x03, 0x0E, 0x02, 0x0C, 0xFF,
+	0xCF, 0xFE, 0x30, 0x73, 0x03, 0x30, 0x33, 0x03, 0x30, 0x63, 0xFE, 0x3F, 0x83, 0x00, 0x30, 0x03,
+	0x00, 0xFF, 0x0F, 0xF0, 0x03, 0x11, 0x02, 0x0C, 0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x7C,
+	0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x60, 0x67, 0x0E, 0x3F, 0xC1, 0xF0, 0x1F, 0x33, 0xFF,
+	0x30, 0xE0, 0x03, 0x0E, 0x01, 0x0E, 0xFF, 0xC3, 0xFF, 0x83, 0x07, 0x0C, 0x0C, 0x30, 0x30, 0xC1,
+	0xC3, 0xFE, 0x0F, 0xE0, 0x31, 0xC0, 0xC3, 0x83, 0x06, 0x0C, 0x1C, 0xFE, 0x3F, 0xF8, 0x70, 0x03,
+	0x0E, 0x03, 0x0A, 0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xC0, 0xFC, 0x07, 0xE0, 0x7E, 0x03, 0xF0, 0x3C,
+	0x0F, 0x87, 0xFF, 0xB7, 0xC0, 0x03, 0x0E, 0x02, 0x0C, 0xFF, 0xFF, 0xFF, 0xC6, 0x3C, 0x63, 0xC6,
+	0x3C, 0x63, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x3F, 0xC3, 0xFC, 0x03, 0x0E,
+	0x01, 0x0E, 0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C,
+	0x30, 0x30, 0xC0, 0xC3, 0x03, 0x06, 0x18, 0x1F, 0xE0, 0x1E, 0x00, 0x03, 0x0E, 0x01, 0x0F, 0xFE,
+	0xFF, 0xFD, 0xFC, 0xC0, 0x60, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x03, 0x18, 0x06, 0x30, 0x06, 0xC0,
+	0x0D, 0x80, 0x1B, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x20, 0x00, 0x03, 0x0E, 0x00, 0x11, 0xFE, 0x3F,
+	0xFF, 0x1F, 0xCC, 0x01, 0x86, 0x00, 0xC3, 0x08, 0x60, 0xCE, 0x60, 0x67, 0x30, 0x36, 0xD8, 0x1B,
+	0x6C, 0x0F, 0x3E, 0x03, 0x8E, 0x01, 0xC7, 0x00, 0xC1, 0x80, 0x60, 0xC0, 0x03, 0x0E, 0x01, 0x0E,
+	0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x06, 0x18, 0x0C, 0xC0, 0x1E, 0x00, 0x30, 0x00, 0xC0, 0x07, 0x80,
+	0x33, 0x01, 0x86, 0x0C, 0x0C, 0xFC, 0xFF, 0xF3, 0xF0, 0x03, 0x0E, 0x01, 0x0E, 0xF8, 0xFF, 0xE3,
+	0xF3, 0x03, 0x06, 0x18, 0x0C, 0xC0, 0x33, 0x00, 0x78, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30,
+	0x00, 0xC0, 0x1F, 0xE0, 0x7F, 0x80, 0x03, 0x0E, 0x02, 0x0B, 0x7F, 0xEF, 0xFD, 0x81, 0xB0, 0x66,
+	0x18, 0xC6, 0x01, 0x80, 0x60, 0x18, 0x66, 0x0D, 0x81, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, 0x02, 0x12,
+	0x07, 0x05, 0xFF, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xFF, 0xC0, 0x00, 0x14,
+	0x03, 0x0A, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03, 0x00, 0x60, 0x18, 0x03, 0x00, 0xC0,
+	0x18, 0x06, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03, 0x02, 0x12, 0x04, 0x05, 0xFF,
+	0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0xFF, 0xC0, 0x01, 0x08, 0x03, 0x0B, 0x04,
+	0x01, 0xC0, 0x7C, 0x1D, 0xC3, 0x18, 0xC1, 0xB0, 0x1C, 0x01, 0x16, 0x02, 0x00, 0x10, 0xFF, 0xFF,
+	0xFF, 0xFF, 0x01, 0x04, 0x06, 0x05, 0xC7, 0x0E, 0x30, 0x06, 0x0B, 0x02, 0x0C, 0x3F, 0x07, 0xF8,
+	0x00, 0xC0, 0x0C, 0x1F, 0xC7, 0xFC, 0xE0, 0xCC, 0x0C, 0xC1, 0xC7, 0xFF, 0x3E, 0xF0, 0x02, 0x0F,
+	0x01, 0x0D, 0xF0, 0x07, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x7C, 0x1F, 0xF8, 0xE0, 0xC6, 0x03, 0x30,
+	0x19, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x83, 0x7F, 0xFB, 0xDF, 0x00, 0x06, 0x0B, 0x02, 0x0C, 0x0F,
+	0xB3, 0xFF, 0x70, 0x7E, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0E, 0x03, 0x70, 0x73, 0xFE, 0x0F, 0xC0,
+	0x02, 0x0F, 0x02, 0x0D, 0x01, 0xE0, 0x0F, 0x00, 0x18, 0x00, 0xC1, 0xF6, 0x3F, 0xF1, 0x83, 0x98,
+	0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80, 0xC6, 0x0E, 0x3F, 0xFC, 0x7D, 0xE0, 0x06, 0x0B, 0x02,
+	0x0C, 0x1F, 0x87, 0xFE, 0x60, 0x6C, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00, 0x60, 0x37, 0xFF,
+	0x1F, 0xC0, 0x02, 0x0F, 0x02, 0x0C, 0x07, 0xF0, 0xFF, 0x18, 0x01, 0x80, 0xFF, 0xEF, 0xFE, 0x18,
+	0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x0F, 0xFC, 0xFF, 0xC0, 0x06, 0x10, 0x02,
+	0x0D, 0x1F, 0x7B, 0xFF, 0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0x60, 0xE3,
+	0xFF, 0x07, 0xD8, 0x00, 0xC0, 0x06, 0x00, 0x70, 0xFF, 0x07, 0xE0, 0x02, 0x0F, 0x01, 0x0E, 0xF0,
+	0x03, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x37, 0xC0, 0xFF, 0x83, 0x87, 0x0C, 0x0C, 0x30, 0x30, 0xC0,
+	0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x33, 0xF3, 0xFF, 0xCF, 0xC0, 0x02, 0x0F, 0x02, 0x0C, 0x06, 0x00,
+	0x60, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+	0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x02, 0x14, 0x03, 0x09, 0x06, 0x03, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
+	0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x81, 0xFF, 0xDF, 0x80,
+	0x02, 0x0F, 0x02, 0x0C, 0xF0, 0x0F, 0x00, 0x30, 0x03, 0x00, 0x33, 0xE3, 0x3E, 0x33, 0x03, 0x60,
+	0x3E, 0x03, 0xC0, 0x3E, 0x03, 0x70, 0x33, 0x8F, 0x1F, 0xF1, 0xF0, 0x02, 0x0F, 0x02, 0x0C, 0x7E,
+	0x07, 0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+	0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x06, 0x0B, 0x00, 0x10, 0xF7, 0x78, 0xFF, 0xFC, 0x39, 0xCC,
+	0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0xFD, 0xEF, 0xFD, 0xEF,
+	0x06, 0x0B, 0x01, 0x0E, 0xF7, 0xC3, 0xFF, 0x83, 0x87, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+	0x0C, 0x0C, 0x30, 0x33, 0xF3, 0xFF, 0xCF, 0xC0, 0x06, 0x0B, 0x02, 0x0C, 0x0F, 0x03, 0xFC, 0x70,
+	0xEE, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x70, 0xE3, 0xFC, 0x0F, 0x00, 0x06, 0x10, 0x01,
+	0x0D, 0xF7, 0xC7, 0xFF, 0x8E, 0x0C, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x38, 0x31,
+	0xFF, 0x8D, 0xF0, 0x60, 0x03, 0x00, 0x18, 0x03, 0xF8, 0x1F, 0xC0, 0x06, 0x10, 0x02, 0x0D, 0x1F,
+	0x7B, 0xFF, 0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0x60, 0xE3, 0xFF, 0x07,
+	0xD8, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x0F, 0xE0, 0x7F, 0x06, 0x0B, 0x02, 0x0C, 0xF9, 0xEF, 0xBF,
+	0x1F, 0x31, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x0F, 0xFC, 0xFF, 0xC0, 0x06, 0x0B,
+	0x03, 0x0A, 0x3F, 0xDF, 0xFC, 0x0F, 0x03, 0xFC, 0x1F, 0xE0, 0x7F, 0x03, 0xC1, 0xFF, 0xEF, 0xF0,
+	0x02, 0x0F, 0x02, 0x0C, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0xFF, 0xCF, 0xFC, 0x30, 0x03, 0x00,
+	0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x71, 0xFF, 0x0F, 0xC0, 0x06, 0x0B, 0x01, 0x0E, 0xF0,
+	0xF3, 0xC3, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x70, 0x7F,
+	0xF0, 0xFB, 0xC0, 0x06, 0x0B, 0x01, 0x0E, 0xF8, 0x7F, 0xE1, 0xF3, 0x03, 0x0C, 0x0C, 0x18, 0x60,
+	0x61, 0x80, 0xCC, 0x03, 0x30, 0x0F, 0xC0, 0x1E, 0x00, 0x78, 0x00, 0x06, 0x0B, 0x01, 0x0D, 0xF0,
+	0x7F, 0x83, 0xD8, 0x8C, 0xCE, 0x66, 0x73, 0x1A, 0xB0, 0xF7, 0x87, 0xBC, 0x38, 0xC0, 0xC6, 0x06,
+	0x30, 0x06, 0x0B, 0x02, 0x0C, 0xF9, 0xFF, 0x9F, 0x30, 0xC1, 0x98, 0x0F, 0x00, 0x60, 0x0F, 0x01,
+	0x98, 0x30, 0xCF, 0x9F, 0xF9, 0xF0, 0x06, 0x10, 0x01, 0x0F, 0xFC, 0x3F, 0xF8, 0x7C, 0xC0, 0x60,
+	0xC1, 0x81, 0x83, 0x01, 0x8C, 0x03, 0x18, 0x03, 0x60, 0x07, 0xC0, 0x07, 0x00, 0x06, 0x00, 0x18,
+	0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x3F, 0xC0, 0x06, 0x0B, 0x03, 0x0A, 0xFF, 0xFF, 0xFC, 0x1B,
+	0x0C, 0x06, 0x03, 0x01, 0x80, 0xC3, 0x60, 0xFF, 0xFF, 0xFC, 0x02, 0x12, 0x05, 0x06, 0x1C, 0xF3,
+	0x0C, 0x30, 0xC3, 0x0C, 0x73, 0x87, 0x0C, 0x30, 0xC3, 0x0C, 0x3C, 0x70, 0x02, 0x12, 0x07, 0x02,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x02, 0x12, 0x05, 0x06, 0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x38,
+	0x73, 0x8C, 0x30, 0xC3, 0x0C, 0xF3, 0x80, 0x08, 0x05, 0x02, 0x0B, 0x38, 0x0F, 0x8F, 0xBB, 0xE3,
+	0xE0, 0x38,
+};
+
+sFONT Font24 = {
+  NULL,
+  17, /* Width */
+  24, /* Height */
+  Font24_Packed,
+  Font24_Offsets,
+};
+
+#endif
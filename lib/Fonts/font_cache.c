@@ -0,0 +1,156 @@
+/*****************************************************************************
+* | File      	:   font_cache.c
+* | Function    :   Glyph lookup, and decode cache for packed fonts
+* | Info        :
+*   Packed fonts only keep the bounding box of each glyph, bit packed
+*   without row padding (see assets/make-packed-font.ts). Glyphs are
+*   expanded back into the regular table layout the first time they are
+*   drawn and kept in a small least recently used cache, so drawing
+*   the same text again costs the same as an unpacked font.
+******************************************************************************/
+#include "fonts.h"
+#include <stddef.h>
+#include <string.h>
+
+typedef struct {
+    const sFONT *Font;
+    char Acsii_Char;
+    uint32_t Last_Used;
+    uint8_t Rows[FONT_CACHE_GLYPH_BYTES];
+} FONT_CACHE_SLOT;
+
+static FONT_CACHE_SLOT Font_Cache[FONT_CACHE_SLOTS];
+static uint32_t Font_Cache_Clock = 0;
+
+/******************************************************************************
+function: Expand a packed glyph into rows padded to whole bytes
+parameter:
+    Font       : A packed font
+    Acsii_Char : Character to decode
+    Rows       : Output, Height * ceil(Width / 8) bytes
+******************************************************************************/
+static void Font_DecodeGlyph(const sFONT *Font, char Acsii_Char, uint8_t *Rows)
+{
+    uint16_t Width_Byte = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+    uint16_t Glyph = Acsii_Char - ' ';
+
+    memset(Rows, 0, Width_Byte * Font->Height);
+
+    // empty glyphs, like space, have no bytes
+    if (Font->offsets[Glyph] == Font->offsets[Glyph + 1])
+        return;
+
+    const uint8_t *ptr = &Font->packed[Font->offsets[Glyph]];
+    uint8_t Top = ptr[0];
+    uint8_t Row_Count = ptr[1];
+    uint8_t Left = ptr[2];
+    uint8_t Column_Count = ptr[3];
+    ptr += 4;
+
+    uint32_t Bit_Buffer = 0;
+    uint8_t Bit_Count = 0;
+    uint8_t Shift = Width_Byte * 8 - Left - Column_Count;
+
+    for (uint8_t Row = 0; Row < Row_Count; Row++) {
+        // columns are at most 24 bits, so the buffer never overflows
+        while (Bit_Count < Column_Count) {
+            Bit_Buffer = (Bit_Buffer << 8) | *ptr++;
+            Bit_Count += 8;
+        }
+
+        Bit_Count -= Column_Count;
+        uint32_t Value = ((Bit_Buffer >> Bit_Count) & ((1UL << Column_Count) - 1)) << Shift;
+
+        uint8_t *Out = &Rows[(Top + Row) * Width_Byte];
+        for (int8_t i = Width_Byte - 1; i >= 0; i--) {
+            Out[i] = Value & 0xff;
+            Value >>= 8;
+        }
+    }
+}
+
+/******************************************************************************
+function: Get the glyph rows of a character
+parameter:
+    Font       : A structure pointer that displays a character size
+    Acsii_Char : Character to look up
+info:
+    Rows are MSB first and padded to whole bytes. Unpacked fonts return a
+    pointer into their table. Packed fonts return a cache slot that stays
+    valid until FONT_CACHE_SLOTS other glyphs have been decoded.
+******************************************************************************/
+const uint8_t* Font_GetGlyph(sFONT* Font, char Acsii_Char)
+{
+    uint16_t Width_Byte = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+
+    if (Font->table != NULL)
+        return &Font->table[(Acsii_Char - ' ') * Font->Height * Width_Byte];
+
+    FONT_CACHE_SLOT *Oldest = &Font_Cache[0];
+
+    for (uint8_t i = 0; i < FONT_CACHE_SLOTS; i++) {
+        FONT_CACHE_SLOT *Slot = &Font_Cache[i];
+        if (Slot->Font == Font && Slot->Acsii_Char == Acsii_Char) {
+            Slot->Last_Used = ++Font_Cache_Clock;
+            return Slot->Rows;
+        }
+        if (Slot->Last_Used < Oldest->Last_Used)
+            Oldest = Slot;
+    }
+
+    if (Width_Byte * Font->Height > FONT_CACHE_GLYPH_BYTES)
+        return NULL;
+
+    Font_DecodeGlyph(Font, Acsii_Char, Oldest->Rows);
+    Oldest->Font = Font;
+    Oldest->Acsii_Char = Acsii_Char;
+    Oldest->Last_Used = ++Font_Cache_Clock;
+
+    return Oldest->Rows;
+}
+
+/******************************************************************************
+function: Get the glyph of a character in an anti-aliased font
+parameter:
+    Font       : A proportional anti-aliased font
+    Acsii_Char : Character to look up
+info:
+    Returns NULL for characters outside the font.
+******************************************************************************/
+const aGLYPH* Font_GetGlyph_AA(const aFONT* Font, char Acsii_Char)
+{
+    uint8_t Code = Acsii_Char;
+
+    if (Code < Font->first || Code > Font->last)
+        return NULL;
+
+    return &Font->glyphs[Code - Font->first];
+}
+
+/******************************************************************************
+function: Get the kerning adjustment between two characters
+parameter:
+    Font  : A proportional anti-aliased font
+    Left  : Character drawn first
+    Right : Character drawn next
+info:
+    Binary searches the pair table, 0 when the pair isn't kerned.
+******************************************************************************/
+int8_t Font_GetKerning_AA(const aFONT* Font, char Left, char Right)
+{
+    uint16_t Key = ((uint8_t)Left << 8) | (uint8_t)Right;
+    int Low = 0, High = Font->kerning_size - 1;
+
+    while (Low <= High) {
+        int Mid = (Low + High) / 2;
+        uint16_t Mid_Key = (Font->kerning[Mid].left << 8) | Font->kerning[Mid].right;
+        if (Mid_Key == Key)
+            return Font->kerning[Mid].adjust;
+        if (Mid_Key < Key)
+            Low = Mid + 1;
+        else
+            High = Mid - 1;
+    }
+
+    return 0;
+}
@@ -54,9 +54,11 @@
 //ASCII
 typedef struct _tFont
 {    
-  const uint8_t *table;
+  const uint8_t *table;                               // NULL when packed
   uint16_t Width;
   uint16_t Height;
+  const uint8_t *packed;                              // see assets/make-packed-font.ts
+  const uint16_t *offsets;                            // per glyph offset into packed
   
 } sFONT;
 
@@ -69,6 +71,14 @@ typedef struct                                          // 
 }CH_CN;
 
 
+//Sorted lookup index into a CH_CN table, see assets/make-cn-font-index.ts
+typedef struct
+{
+  uint16_t code;                                      // index[0] << 8 | index[1]
+  uint16_t entry;                                     // position in the table
+}CH_CN_INDEX;
+
+
 typedef struct
 {    
   const CH_CN *table;
@@ -76,9 +86,45 @@ typedef struct
   uint16_t ASCII_Width;
   uint16_t Width;
   uint16_t Height;
+  const CH_CN_INDEX *lookup;                          // NULL to scan the table
+  uint16_t lookup_size;
   
 }cFONT;
 
+
+//Proportional anti-aliased font, see assets/make-font.ts
+typedef struct
+{
+  uint16_t offset;                                    // into aFONT bitmap
+  uint8_t width;                                      // bitmap size
+  uint8_t height;
+  int8_t x_offset;                                    // pen to bitmap left
+  int8_t y_offset;                                    // line top to bitmap top
+  uint8_t advance;                                    // pen movement
+}aGLYPH;
+
+
+typedef struct
+{
+  uint8_t left;
+  uint8_t right;
+  int8_t adjust;                                      // added to advance of left
+}aKERN;
+
+
+typedef struct
+{
+  const uint8_t *bitmap;                              // alpha, msb first, rows not padded
+  const aGLYPH *glyphs;                               // first to last
+  const aKERN *kerning;                               // sorted by left then right
+  uint16_t kerning_size;
+  uint8_t first;
+  uint8_t last;
+  uint8_t bpp;                                        // 2 or 4 bits of alpha
+  uint8_t Height;                                     // line height
+  
+}aFONT;
+
 extern sFONT Font24;
 extern sFONT Font20;
 extern sFONT Font16;
@@ -87,6 +133,14 @@ extern sFONT Font8;
 
 extern cFONT Font12CN;
 extern cFONT Font24CN;
+
+//Glyph rows for a character, decoded into a small cache for packed fonts
+#define FONT_CACHE_SLOTS        8
+#define FONT_CACHE_GLYPH_BYTES  72                    // Font24, 3 bytes x 24 rows
+
+const uint8_t* Font_GetGlyph(sFONT* Font, char Acsii_Char);
+const aGLYPH* Font_GetGlyph_AA(const aFONT* Font, char Acsii_Char);
+int8_t Font_GetKerning_AA(const aFONT* Font, char Left, char Right);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,895 @@
+#ifndef LATO_20
+#define LATO_20
+// generated by assets/make-font.ts from Lato-Regular.ttf, 20px, 4 bit alpha
+#include "fonts.h"
+const uint8_t lato_20_bitmap[6022] = {
+	72,40,244,143,72,244,143,72,244,143,68,244,79,67,177,0,
+	0,0,56,59,250,108,80,72,2,132,143,4,248,143,4,248,
+	143,2,246,95,0,244,22,0,113,0,0,86,0,101,0,0,
+	13,144,14,128,0,1,247,2,246,0,0,79,64,95,48,3,
+	73,244,73,244,64,239,255,255,255,252,0,11,160,12,144,0,
+	0,248,0,247,0,0,63,64,79,64,6,188,252,188,251,180,
+	56,191,136,206,136,32,11,176,11,176,0,0,232,0,248,0,
+	0,47,96,63,80,0,3,178,2,178,0,0,0,0,8,48,
+	0,0,0,15,64,0,0,23,191,149,0,3,239,239,239,177,
+	13,227,79,6,160,79,112,78,0,0,79,112,75,0,0,47,
+	227,107,0,0,8,255,220,16,0,0,91,255,249,32,0,0,
+	139,191,225,0,0,168,8,248,0,0,184,1,248,0,0,180,
+	3,247,140,48,196,28,242,111,251,252,239,96,2,139,252,147,
+	0,0,0,240,0,0,0,2,240,0,0,0,107,165,0,0,
+	0,118,0,142,136,245,0,0,127,48,47,96,8,208,0,63,
+	112,4,243,0,79,0,29,160,0,79,64,6,240,10,225,0,
+	0,232,0,171,7,244,0,0,6,252,222,51,248,0,0,0,
+	2,118,17,219,0,67,0,0,0,0,174,20,239,251,16,0,
+	0,127,65,233,1,217,0,0,63,128,79,32,8,224,0,29,
+	176,4,240,0,143,0,10,225,0,63,48,8,208,7,244,0,
+	0,204,86,230,1,182,0,0,1,158,199,0,0,0,73,186,
+	64,0,0,0,6,253,189,246,0,0,0,30,193,0,191,16,
+	0,0,79,128,0,56,16,0,0,63,128,0,0,0,0,0,
+	13,225,0,0,0,0,0,5,252,16,0,0,0,0,110,223,
+	193,0,26,64,5,249,6,252,16,79,64,13,208,0,111,193,
+	143,16,63,176,0,6,252,233,0,47,176,0,0,111,243,0,
+	13,245,0,1,159,252,16,3,239,168,174,230,111,193,0,41,
+	206,183,16,6,184,72,143,143,143,95,22,0,40,0,9,225,
+	2,248,0,159,16,14,160,4,246,0,127,48,8,240,0,175,
+	0,11,240,0,159,0,8,240,0,127,48,3,247,0,14,160,
+	0,143,32,2,248,0,9,224,0,23,0,24,16,2,248,0,
+	9,225,0,47,112,0,204,0,8,241,0,79,64,2,248,0,
+	15,128,0,248,0,15,128,3,247,0,95,64,8,241,0,220,
+	0,63,112,9,225,2,248,0,7,0,0,0,34,0,0,136,
+	0,200,136,138,24,237,129,59,237,178,148,136,73,0,136,0,
+	0,0,248,0,0,0,0,248,0,0,0,0,248,0,0,0,
+	0,248,0,0,187,187,253,187,182,187,187,253,187,182,0,0,
+	248,0,0,0,0,248,0,0,0,0,248,0,0,0,0,248,
+	0,0,103,15,244,142,65,208,181,2,0,255,255,248,136,136,
+	87,15,244,172,32,0,0,1,230,0,0,7,225,0,0,13,
+	144,0,0,79,48,0,0,156,0,0,1,246,0,0,7,225,
+	0,0,13,144,0,0,79,48,0,0,156,0,0,1,246,0,
+	0,7,225,0,0,13,144,0,0,79,48,0,0,156,0,0,
+	0,163,0,0,0,0,2,139,183,16,0,6,255,189,253,32,
+	4,252,32,6,252,0,175,48,0,9,245,31,192,0,0,63,
+	148,248,0,0,0,252,95,128,0,0,14,248,248,0,0,0,
+	191,111,128,0,0,13,244,248,0,0,0,253,31,176,0,0,
+	63,160,191,32,0,8,246,5,251,16,3,237,0,9,253,155,
+	254,48,0,5,173,201,32,0,0,1,134,0,0,3,207,176,
+	0,3,238,251,0,6,254,63,176,0,172,16,251,0,0,0,
+	15,176,0,0,0,251,0,0,0,15,176,0,0,0,251,0,
+	0,0,15,176,0,0,0,251,0,0,0,15,176,0,0,0,
+	251,0,2,136,143,216,132,59,187,187,187,96,0,40,187,130,
+	0,6,255,204,254,80,46,194,0,78,224,143,80,0,9,244,
+	71,0,0,8,244,0,0,0,10,242,0,0,0,63,176,0,
+	0,1,206,32,0,0,28,243,0,0,1,207,96,0,0,28,
+	246,0,0,1,207,96,0,0,28,246,0,0,0,191,238,255,
+	255,247,187,187,187,187,182,0,23,187,148,0,3,239,203,255,
+	96,13,228,0,45,242,95,128,0,8,245,40,16,0,6,245,
+	0,0,0,10,225,0,0,54,190,80,0,0,191,250,32,0,
+	0,2,110,225,0,0,0,5,248,19,0,0,0,251,190,16,
+	0,4,249,111,161,0,28,244,9,253,171,239,144,0,107,237,
+	164,0,0,0,0,7,128,0,0,0,0,127,240,0,0,0,
+	3,254,240,0,0,0,29,200,240,0,0,0,174,40,240,0,
+	0,7,245,8,240,0,0,63,128,8,240,0,1,236,16,8,
+	240,0,11,227,0,8,240,0,127,200,136,139,248,130,127,255,
+	255,255,255,243,0,0,0,8,240,0,0,0,0,8,240,0,
+	0,0,0,8,240,0,0,0,0,6,176,0,0,136,136,136,
+	96,4,255,255,255,160,6,243,0,0,0,8,240,0,0,0,
+	11,176,0,0,0,13,181,134,32,0,31,255,255,248,0,5,
+	81,4,191,128,0,0,0,29,240,0,0,0,9,244,0,0,
+	0,8,244,0,0,0,13,224,72,16,0,159,128,175,235,189,
+	251,0,6,173,234,96,0,0,0,3,134,0,0,0,30,227,
+	0,0,0,191,96,0,0,8,248,0,0,0,79,176,0,0,
+	1,238,16,0,0,10,251,239,233,16,79,249,86,191,192,175,
+	112,0,9,247,222,0,0,2,250,235,0,0,0,251,191,0,
+	0,5,248,111,144,0,28,242,9,252,137,239,96,0,107,237,
+	148,0,136,136,136,136,134,239,255,255,255,251,0,0,0,5,
+	246,0,0,0,13,208,0,0,0,111,128,0,0,0,222,16,
+	0,0,6,248,0,0,0,13,225,0,0,0,111,128,0,0,
+	0,222,16,0,0,6,248,0,0,0,13,225,0,0,0,111,
+	128,0,0,1,222,16,0,0,5,182,0,0,0,0,73,187,
+	113,0,8,253,187,254,48,63,160,0,63,176,143,64,0,11,
+	240,143,64,0,10,240,79,144,0,30,208,8,250,136,222,48,
+	3,191,255,248,16,95,197,1,127,193,223,16,0,8,246,251,
+	0,0,4,248,253,0,0,5,248,175,96,0,28,244,45,251,
+	136,223,144,1,139,237,164,0,0,23,187,148,0,3,239,203,
+	239,96,13,228,0,28,244,111,128,0,2,249,143,64,0,0,
+	251,143,96,0,1,251,63,193,0,9,248,8,253,136,207,242,
+	0,107,187,143,144,0,0,1,221,16,0,0,10,244,0,0,
+	0,127,128,0,0,4,252,16,0,0,30,243,0,0,0,139,
+	96,0,0,143,138,250,22,16,0,0,0,0,0,3,131,175,
+	182,214,143,138,250,22,16,0,0,0,0,0,3,131,159,179,
+	218,9,101,176,49,0,0,0,0,1,16,0,0,24,228,0,
+	0,142,249,16,6,223,146,0,77,249,32,0,4,222,146,0,
+	0,0,110,249,32,0,0,24,239,145,0,0,1,142,64,0,
+	0,0,17,36,68,68,68,72,255,255,255,255,0,0,0,0,
+	0,0,0,0,0,143,255,255,255,242,68,68,68,68,16,0,
+	0,0,139,64,0,0,59,251,64,0,0,93,251,64,0,0,
+	109,249,0,0,75,251,0,75,251,64,59,251,64,0,140,64,
+	0,0,32,0,0,0,2,139,183,16,95,235,207,193,56,0,
+	7,247,0,0,1,248,0,0,4,247,0,0,44,225,0,4,
+	237,48,0,30,193,0,0,31,80,0,0,11,48,0,0,0,
+	0,0,0,0,0,0,0,56,48,0,0,175,176,0,0,93,
+	96,0,0,0,3,139,187,149,0,0,0,1,175,167,70,141,
+	195,0,0,28,194,0,0,0,158,48,0,188,16,0,0,0,
+	9,176,4,242,0,4,139,166,1,243,10,144,0,159,152,218,
+	0,184,15,80,8,227,0,215,0,185,47,64,14,128,2,243,
+	0,184,47,64,79,48,7,224,0,215,15,64,79,32,11,176,
+	4,242,12,128,30,165,171,245,110,96,8,208,5,187,128,140,
+	181,0,1,232,0,0,0,0,0,0,0,79,128,0,0,0,
+	2,16,0,4,237,115,0,53,159,80,0,0,23,207,255,253,
+	146,0,0,0,0,0,17,0,0,0,0,0,2,136,0,0,
+	0,0,0,9,255,64,0,0,0,0,30,223,144,0,0,0,
+	0,111,124,241,0,0,0,0,207,22,247,0,0,0,3,249,
+	1,253,0,0,0,9,244,0,159,64,0,0,30,208,0,79,
+	144,0,0,111,128,0,13,241,0,0,207,152,136,139,247,0,
+	3,253,187,187,187,253,0,9,246,0,0,0,175,64,30,224,
+	0,0,0,95,144,111,128,0,0,0,14,241,139,32,0,0,
+	0,6,181,40,136,136,134,16,4,255,255,255,254,80,79,176,
+	0,23,254,20,251,0,0,10,244,79,176,0,0,143,68,251,
+	0,0,13,225,79,196,68,91,230,4,255,255,255,231,16,79,
+	196,68,72,237,36,251,0,0,6,249,79,176,0,0,15,180,
+	251,0,0,3,251,79,176,0,2,207,100,254,187,188,255,144,
+	59,187,187,184,64,0,0,0,105,187,150,0,0,77,255,255,
+	255,212,5,255,130,0,24,232,30,246,0,0,0,32,143,144,
+	0,0,0,0,223,48,0,0,0,0,255,0,0,0,0,0,
+	255,0,0,0,0,0,255,0,0,0,0,0,239,32,0,0,
+	0,0,159,128,0,0,0,0,47,227,0,0,0,32,8,254,
+	96,0,6,232,0,143,254,187,239,211,0,2,139,253,183,16,
+	40,136,136,136,48,0,0,79,255,255,255,253,64,0,79,176,
+	0,2,142,246,0,79,176,0,0,3,238,32,79,176,0,0,
+	0,143,144,79,176,0,0,0,47,224,79,176,0,0,0,14,
+	241,79,176,0,0,0,11,244,79,176,0,0,0,13,242,79,
+	176,0,0,0,31,224,79,176,0,0,0,111,144,79,176,0,
+	0,3,239,48,79,176,0,0,110,246,0,79,235,187,207,254,
+	96,0,59,187,187,185,97,0,0,40,136,136,136,132,79,255,
+	255,255,248,79,176,0,0,0,79,176,0,0,0,79,176,0,
+	0,0,79,176,0,0,0,79,196,68,68,16,79,255,255,255,
+	64,79,196,68,68,16,79,176,0,0,0,79,176,0,0,0,
+	79,176,0,0,0,79,176,0,0,0,79,235,187,187,182,59,
+	187,187,187,182,40,136,136,136,132,79,255,255,255,248,79,176,
+	0,0,0,79,176,0,0,0,79,176,0,0,0,79,176,0,
+	0,0,79,176,0,0,0,79,255,255,255,128,79,216,136,136,
+	64,79,176,0,0,0,79,176,0,0,0,79,176,0,0,0,
+	79,176,0,0,0,79,176,0,0,0,59,128,0,0,0,0,
+	0,88,187,167,32,0,4,223,255,255,255,128,6,255,130,0,
+	5,206,18,239,96,0,0,0,32,143,144,0,0,0,0,13,
+	243,0,0,0,0,0,255,0,0,0,0,0,15,240,0,0,
+	4,68,66,255,0,0,0,255,255,141,242,0,0,4,71,248,
+	159,128,0,0,0,79,130,254,48,0,0,4,248,6,254,64,
+	0,1,143,128,6,239,219,187,255,212,0,2,123,238,186,96,
+	0,40,96,0,0,0,72,36,251,0,0,0,8,244,79,176,
+	0,0,0,143,68,251,0,0,0,8,244,79,176,0,0,0,
+	143,68,251,0,0,0,8,244,79,196,68,68,68,159,68,255,
+	255,255,255,255,244,79,196,68,68,68,159,68,251,0,0,0,
+	8,244,79,176,0,0,0,143,68,251,0,0,0,8,244,79,
+	176,0,0,0,143,68,251,0,0,0,8,244,59,128,0,0,
+	0,107,48,136,255,255,255,255,255,255,255,255,255,255,255,255,
+	255,187,0,0,6,130,0,0,11,244,0,0,11,244,0,0,
+	11,244,0,0,11,244,0,0,11,244,0,0,11,244,0,0,
+	11,244,0,0,11,244,0,0,11,244,0,0,11,240,0,0,
+	31,224,0,0,159,144,60,189,254,16,91,252,129,0,134,0,
+	0,0,56,80,251,0,0,3,238,32,251,0,0,46,227,0,
+	251,0,1,207,80,0,251,0,28,246,0,0,251,0,159,128,
+	0,0,252,74,249,0,0,0,255,255,244,0,0,0,252,71,
+	254,48,0,0,251,0,111,225,0,0,251,0,8,252,16,0,
+	251,0,0,159,144,0,251,0,0,12,248,0,251,0,0,1,
+	207,96,184,0,0,0,42,161,40,96,0,0,4,251,0,0,
+	0,79,176,0,0,4,251,0,0,0,79,176,0,0,4,251,
+	0,0,0,79,176,0,0,4,251,0,0,0,79,176,0,0,
+	4,251,0,0,0,79,176,0,0,4,251,0,0,0,79,176,
+	0,0,4,255,255,255,255,59,187,187,187,176,40,112,0,0,
+	0,0,4,134,79,244,0,0,0,0,13,251,79,252,0,0,
+	0,0,127,251,79,239,96,0,0,1,237,251,79,141,225,0,
+	0,8,245,251,79,134,248,0,0,46,176,251,79,128,190,32,
+	0,159,64,251,79,128,79,144,3,250,0,251,79,128,10,243,
+	11,242,0,251,79,128,2,251,79,128,0,251,79,128,0,143,
+	222,16,0,251,79,128,0,30,248,0,0,251,79,128,0,6,
+	161,0,0,251,79,128,0,0,0,0,0,251,59,96,0,0,
+	0,0,0,184,40,48,0,0,0,40,36,254,16,0,0,4,
+	244,79,251,0,0,0,79,68,255,248,0,0,4,244,79,140,
+	245,0,0,79,68,248,62,226,0,4,244,79,128,111,192,0,
+	79,68,248,0,159,144,4,244,79,128,0,207,96,79,68,248,
+	0,2,238,52,244,79,128,0,5,252,95,68,248,0,0,8,
+	253,244,79,128,0,0,11,255,68,248,0,0,0,30,244,59,
+	96,0,0,0,59,48,0,0,105,187,150,0,0,0,77,255,
+	255,255,212,0,5,255,130,0,40,255,80,30,243,0,0,0,
+	111,225,143,128,0,0,0,9,248,207,48,0,0,0,3,252,
+	255,0,0,0,0,0,255,255,0,0,0,0,0,255,255,0,
+	0,0,0,0,255,223,32,0,0,0,3,252,159,128,0,0,
+	0,8,248,47,227,0,0,0,62,226,6,254,96,0,6,239,
+	96,0,110,255,187,255,230,0,0,2,123,221,183,16,0,136,
+	136,136,80,0,255,255,255,253,48,251,0,1,143,208,251,0,
+	0,11,245,251,0,0,8,248,251,0,0,8,248,251,0,0,
+	29,243,252,68,70,207,160,255,255,255,248,0,253,136,100,16,
+	0,251,0,0,0,0,251,0,0,0,0,251,0,0,0,0,
+	251,0,0,0,0,184,0,0,0,0,0,0,105,187,150,0,
+	0,0,4,223,255,255,253,64,0,5,255,130,0,40,255,80,
+	1,239,48,0,0,6,254,16,143,128,0,0,0,9,248,12,
+	243,0,0,0,0,63,192,255,0,0,0,0,0,255,15,240,
+	0,0,0,0,15,240,255,0,0,0,0,0,255,13,242,0,
+	0,0,0,63,192,159,128,0,0,0,8,248,2,254,48,0,
+	0,3,238,32,6,254,96,0,6,239,96,0,6,239,251,191,
+	255,112,0,0,2,123,221,186,251,0,0,0,0,0,0,9,
+	249,0,0,0,0,0,0,9,249,0,0,0,0,0,0,25,
+	182,136,136,136,64,0,15,255,255,255,195,0,251,0,2,159,
+	192,15,176,0,0,207,48,251,0,0,11,244,15,176,0,0,
+	207,32,251,0,0,127,144,15,235,187,223,161,0,254,187,255,
+	64,0,15,176,8,250,0,0,251,0,11,247,0,15,176,0,
+	30,227,0,251,0,0,95,193,15,176,0,0,143,144,184,0,
+	0,0,171,48,0,4,155,183,16,0,159,252,255,229,6,249,
+	16,6,210,11,241,0,0,0,11,241,0,0,0,9,249,16,
+	0,0,2,239,233,80,0,0,41,239,253,80,0,0,5,159,
+	245,0,0,0,6,251,0,0,0,0,251,1,0,0,1,251,
+	46,145,0,25,246,28,255,187,239,144,0,106,222,182,0,104,
+	136,136,136,136,132,191,255,255,255,255,248,0,0,15,176,0,
+	0,0,0,15,176,0,0,0,0,15,176,0,0,0,0,15,
+	176,0,0,0,0,15,176,0,0,0,0,15,176,0,0,0,
+	0,15,176,0,0,0,0,15,176,0,0,0,0,15,176,0,
+	0,0,0,15,176,0,0,0,0,15,176,0,0,0,0,15,
+	176,0,0,0,0,11,128,0,0,72,64,0,0,0,136,143,
+	128,0,0,0,255,143,128,0,0,0,255,143,128,0,0,0,
+	255,143,128,0,0,0,255,143,128,0,0,0,255,143,128,0,
+	0,0,255,143,128,0,0,0,255,143,128,0,0,0,255,127,
+	128,0,0,0,255,79,160,0,0,2,253,14,243,0,0,8,
+	249,8,252,64,0,127,226,0,159,253,190,254,48,0,4,173,
+	251,130,0,104,32,0,0,0,5,131,143,128,0,0,0,14,
+	241,31,224,0,0,0,111,144,9,246,0,0,0,191,64,4,
+	251,0,0,2,253,0,0,223,32,0,8,247,0,0,127,128,
+	0,14,241,0,0,31,224,0,111,144,0,0,9,246,0,191,
+	48,0,0,3,251,2,252,0,0,0,0,207,40,246,0,0,
+	0,0,111,142,225,0,0,0,0,30,239,144,0,0,0,0,
+	9,255,32,0,0,0,0,3,185,0,0,0,104,48,0,0,
+	5,129,0,0,0,120,24,249,0,0,0,223,96,0,0,47,
+	208,63,208,0,0,63,250,0,0,7,248,0,223,48,0,8,
+	251,241,0,0,175,80,8,248,0,0,236,111,96,0,15,224,
+	0,95,192,0,95,113,250,0,5,249,0,0,239,16,9,242,
+	10,242,0,159,80,0,9,246,0,236,0,111,112,13,241,0,
+	0,111,160,95,112,1,252,3,250,0,0,1,254,9,242,0,
+	10,242,143,96,0,0,10,245,236,0,0,111,124,241,0,0,
+	0,111,191,112,0,1,251,252,0,0,0,2,255,242,0,0,
+	10,255,112,0,0,0,12,252,0,0,0,111,242,0,0,0,
+	0,107,96,0,0,1,185,0,0,0,56,112,0,0,0,104,
+	49,223,80,0,0,79,176,4,253,16,0,29,226,0,8,248,
+	0,10,247,0,0,29,244,5,251,0,0,0,63,210,238,16,
+	0,0,0,143,239,80,0,0,0,1,255,225,0,0,0,0,
+	175,207,128,0,0,0,95,176,223,64,0,0,30,226,4,253,
+	16,0,10,247,0,8,248,0,5,251,0,0,30,244,1,238,
+	32,0,0,95,209,123,96,0,0,0,139,80,104,48,0,0,
+	0,104,52,252,0,0,0,79,208,10,247,0,0,12,244,0,
+	30,225,0,6,249,0,0,127,128,1,238,16,0,0,207,48,
+	143,112,0,0,4,251,47,192,0,0,0,9,252,243,0,0,
+	0,0,30,248,0,0,0,0,0,191,64,0,0,0,0,11,
+	244,0,0,0,0,0,191,64,0,0,0,0,11,244,0,0,
+	0,0,0,191,64,0,0,0,0,8,179,0,0,0,6,136,
+	136,136,136,134,11,255,255,255,255,249,0,0,0,0,63,225,
+	0,0,0,1,223,64,0,0,0,9,248,0,0,0,0,95,
+	192,0,0,0,2,239,48,0,0,0,11,247,0,0,0,0,
+	127,176,0,0,0,3,254,16,0,0,0,28,245,0,0,0,
+	0,143,128,0,0,0,5,252,16,0,0,0,30,253,187,187,
+	187,182,59,187,187,187,187,182,72,136,143,136,143,0,143,0,
+	143,0,143,0,143,0,143,0,143,0,143,0,143,0,143,0,
+	143,0,143,0,143,0,143,0,143,0,143,136,107,187,30,80,
+	0,0,0,157,0,0,0,3,244,0,0,0,12,144,0,0,
+	0,111,16,0,0,1,231,0,0,0,9,208,0,0,0,63,
+	64,0,0,0,201,0,0,0,6,241,0,0,0,30,112,0,
+	0,0,157,0,0,0,3,244,0,0,0,12,144,0,0,0,
+	111,16,0,0,1,149,136,132,136,248,0,248,0,248,0,248,
+	0,248,0,248,0,248,0,248,0,248,0,248,0,248,0,248,
+	0,248,0,248,0,248,0,248,136,248,187,182,0,0,132,0,
+	0,0,127,208,0,0,30,191,128,0,8,242,142,16,2,248,
+	1,232,0,158,16,8,242,43,112,0,10,112,136,136,136,136,
+	136,136,136,136,59,128,0,127,96,0,158,16,0,88,135,16,
+	44,255,239,209,93,64,6,249,0,0,0,236,0,0,0,191,
+	1,122,207,255,110,216,68,207,236,0,0,191,251,0,3,239,
+	191,133,141,207,26,236,145,91,143,64,0,0,0,143,64,0,
+	0,0,143,64,0,0,0,143,64,0,0,0,143,65,104,114,
+	0,143,125,238,254,48,143,228,0,111,208,143,80,0,10,243,
+	143,64,0,8,247,143,64,0,8,248,143,64,0,8,247,143,
+	64,0,9,243,143,112,0,63,208,143,235,137,238,48,107,56,
+	188,146,0,0,2,136,130,0,8,255,190,248,7,249,16,7,
+	64,222,16,0,0,63,160,0,0,4,248,0,0,0,79,144,
+	0,0,0,253,0,0,0,9,246,0,3,64,28,250,137,251,
+	0,24,189,182,0,0,0,0,4,251,0,0,0,4,251,0,
+	0,0,4,251,0,0,0,4,251,0,4,136,100,251,0,159,
+	251,252,251,8,249,16,25,251,14,225,0,4,251,63,160,0,
+	4,251,79,128,0,4,251,79,128,0,4,251,47,176,0,4,
+	251,12,243,0,9,251,4,254,152,217,251,0,74,219,96,168,
+	0,2,136,114,0,0,143,219,238,96,8,248,0,9,242,14,
+	208,0,1,248,63,200,136,136,250,79,219,187,187,184,79,128,
+	0,0,0,14,192,0,0,0,8,246,0,0,113,1,207,184,
+	141,245,0,23,189,185,32,0,6,187,96,8,253,132,0,237,
+	0,0,47,128,0,55,249,68,42,255,255,248,4,251,0,0,
+	79,176,0,4,251,0,0,79,176,0,4,251,0,0,79,176,
+	0,4,251,0,0,79,176,0,3,184,0,0,0,22,136,80,
+	0,3,223,188,255,254,10,227,0,111,145,15,176,0,15,160,
+	13,192,0,31,128,6,250,69,206,32,0,190,255,163,0,8,
+	241,0,0,0,9,249,135,67,0,2,239,255,255,211,46,128,
+	0,55,249,143,0,0,0,249,111,145,0,41,243,8,239,255,
+	253,64,0,20,118,48,0,143,64,0,0,8,244,0,0,0,
+	143,64,0,0,8,244,0,0,0,143,65,120,113,8,248,238,
+	255,225,143,228,0,143,152,245,0,0,252,143,64,0,15,248,
+	244,0,0,255,143,64,0,15,248,244,0,0,255,143,64,0,
+	15,248,244,0,0,255,107,48,0,11,176,91,106,251,58,64,
+	0,40,68,248,79,132,248,79,132,248,79,132,248,79,132,248,
+	59,96,0,91,96,10,251,0,58,64,0,0,0,40,64,4,
+	248,0,79,128,4,248,0,79,128,4,248,0,79,128,4,248,
+	0,79,128,4,248,0,79,128,4,248,0,175,88,255,192,37,
+	64,0,143,64,0,0,8,244,0,0,0,143,64,0,0,8,
+	244,0,0,0,143,64,0,24,120,244,0,28,227,143,64,28,
+	227,8,244,12,227,0,143,122,244,0,8,255,253,16,0,143,
+	68,252,0,8,244,7,249,0,143,64,9,246,8,244,0,28,
+	243,107,48,0,26,144,79,132,248,79,132,248,79,132,248,79,
+	132,248,79,132,248,79,132,248,79,132,248,59,96,71,2,136,
+	32,5,136,32,8,246,254,254,43,254,255,80,143,194,3,237,
+	193,3,237,8,244,0,9,245,0,10,243,143,64,0,143,64,
+	0,143,72,244,0,8,244,0,8,244,143,64,0,143,64,0,
+	143,72,244,0,8,244,0,8,244,143,64,0,143,64,0,143,
+	72,244,0,8,244,0,8,244,107,48,0,107,48,0,107,48,
+	71,1,120,113,8,245,238,255,225,143,228,0,143,152,245,0,
+	0,252,143,64,0,15,248,244,0,0,255,143,64,0,15,248,
+	244,0,0,255,143,64,0,15,248,244,0,0,255,107,48,0,
+	11,176,0,2,120,131,0,0,8,255,191,249,0,7,249,16,
+	9,248,0,238,16,0,13,241,63,160,0,0,143,68,248,0,
+	0,8,246,79,128,0,0,143,65,252,0,0,10,242,9,246,
+	0,4,251,0,28,250,137,254,32,0,24,189,184,16,0,71,
+	1,120,113,0,143,62,238,254,48,143,228,0,111,176,143,80,
+	0,12,242,143,64,0,8,244,143,64,0,8,248,143,64,0,
+	8,244,143,64,0,10,242,143,112,0,79,176,143,234,137,254,
+	48,143,89,204,146,0,143,64,0,0,0,143,64,0,0,0,
+	143,64,0,0,0,36,16,0,0,0,0,4,136,96,86,0,
+	159,251,249,251,8,249,16,25,251,14,225,0,4,251,63,160,
+	0,4,251,79,128,0,4,251,79,128,0,4,251,47,176,0,
+	4,251,12,243,0,9,251,4,254,152,220,251,0,74,219,100,
+	251,0,0,0,4,251,0,0,0,4,251,0,0,0,4,251,
+	0,0,0,1,67,71,1,120,56,242,239,248,143,216,68,40,
+	250,0,0,143,64,0,8,244,0,0,143,64,0,8,244,0,
+	0,143,64,0,8,244,0,0,107,48,0,0,0,39,135,32,
+	6,254,190,246,14,209,0,98,15,144,0,0,13,249,48,0,
+	3,191,253,128,0,2,125,248,0,0,1,235,3,0,1,234,
+	63,184,139,244,4,173,218,64,0,88,0,0,8,176,0,0,
+	187,0,0,45,196,67,143,255,255,176,15,176,0,0,251,0,
+	0,15,176,0,0,251,0,0,15,176,0,0,251,0,0,15,
+	192,0,0,191,169,160,3,175,181,104,0,0,40,107,240,0,
+	4,251,191,0,0,79,187,240,0,4,251,191,0,0,79,187,
+	240,0,4,251,191,0,0,79,187,240,0,4,251,159,80,0,
+	159,179,254,136,219,251,4,174,183,10,128,103,16,0,0,88,
+	127,96,0,2,250,31,192,0,8,245,9,243,0,13,208,4,
+	249,0,79,112,0,222,0,159,16,0,111,97,249,0,0,30,
+	183,244,0,0,9,251,208,0,0,3,255,96,0,0,0,155,
+	16,0,103,0,0,24,48,0,3,129,143,64,0,111,192,0,
+	12,208,79,128,0,174,242,0,47,128,14,208,1,248,247,0,
+	127,80,9,242,5,242,202,0,190,0,5,247,9,192,127,17,
+	249,0,0,234,14,112,47,102,245,0,0,159,95,32,12,169,
+	224,0,0,95,220,0,7,237,144,0,0,14,247,0,2,255,
+	80,0,0,8,178,0,0,155,0,0,72,64,0,2,133,30,
+	225,0,12,225,4,250,0,143,80,0,143,83,248,0,0,29,
+	236,209,0,0,6,255,96,0,0,12,238,209,0,0,143,85,
+	248,0,3,250,0,175,64,28,225,0,30,209,107,80,0,6,
+	182,103,16,0,0,88,143,112,0,2,250,30,208,0,8,244,
+	9,245,0,13,208,2,251,0,95,96,0,191,32,190,16,0,
+	79,146,248,0,0,13,232,242,0,0,6,255,160,0,0,1,
+	239,64,0,0,0,220,0,0,0,5,246,0,0,0,11,224,
+	0,0,0,79,128,0,0,0,36,0,0,0,8,136,136,136,
+	64,255,255,255,248,0,0,1,221,16,0,0,175,48,0,0,
+	127,112,0,0,63,160,0,0,28,209,0,0,9,243,0,0,
+	6,247,0,0,2,239,187,187,179,59,187,187,187,48,0,23,
+	128,46,216,8,241,0,188,0,9,240,0,143,16,4,244,0,
+	79,64,8,226,8,245,0,8,226,0,79,64,4,244,0,143,
+	16,9,240,0,188,0,8,241,0,46,216,0,40,160,102,187,
+	187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,187,
+	187,51,135,16,8,222,32,1,248,0,12,176,0,249,0,31,
+	128,4,244,0,79,64,2,232,0,5,248,2,232,0,79,64,
+	4,244,0,31,128,0,249,0,12,176,1,248,8,222,32,168,
+	32,0,2,118,16,1,247,62,255,249,138,242,173,34,141,254,
+	96,101,0,0,0,0,
+};
+const aGLYPH lato_20_glyphs[95] = {
+	{0, 0, 0, 0, 0, 4}, //  
+	{0, 3, 15, 2, 5, 7}, // !
+	{23, 6, 6, 1, 5, 8}, // "
+	{41, 11, 15, 0, 5, 12}, // #
+	{124, 10, 19, 1, 3, 12}, // $
+	{219, 15, 15, 0, 5, 16}, // %
+	{332, 14, 15, 0, 5, 14}, // &
+	{437, 2, 6, 1, 5, 5}, // '
+	{443, 5, 19, 1, 4, 6}, // (
+	{491, 5, 19, 0, 4, 6}, // )
+	{539, 6, 7, 1, 4, 8}, // *
+	{560, 10, 10, 1, 8, 12}, // +
+	{610, 3, 6, 1, 17, 4}, // ,
+	{619, 5, 2, 1, 13, 7}, // -
+	{624, 3, 3, 1, 17, 4}, // .
+	{629, 8, 16, 0, 5, 7}, // /
+	{693, 11, 15, 0, 5, 12}, // 0
+	{776, 9, 15, 2, 5, 12}, // 1
+	{844, 10, 15, 1, 5, 12}, // 2
+	{919, 10, 15, 1, 5, 12}, // 3
+	{994, 12, 15, 0, 5, 12}, // 4
+	{1084, 10, 15, 1, 5, 12}, // 5
+	{1159, 10, 15, 1, 5, 12}, // 6
+	{1234, 10, 15, 1, 5, 12}, // 7
+	{1309, 10, 15, 1, 5, 12}, // 8
+	{1384, 10, 15, 1, 5, 12}, // 9
+	{1459, 3, 10, 1, 10, 5}, // :
+	{1474, 3, 13, 1, 10, 5}, // ;
+	{1494, 9, 10, 1, 8, 12}, // <
+	{1539, 9, 6, 1, 10, 12}, // =
+	{1566, 8, 10, 2, 8, 12}, // >
+	{1606, 8, 15, 0, 5, 8}, // ?
+	{1666, 16, 17, 0, 6, 16}, // @
+	{1802, 14, 15, 0, 5, 14}, // A
+	{1907, 11, 15, 1, 5, 13}, // B
+	{1990, 12, 15, 1, 5, 14}, // C
+	{2080, 14, 15, 1, 5, 15}, // D
+	{2185, 10, 15, 1, 5, 12}, // E
+	{2260, 10, 15, 1, 5, 11}, // F
+	{2335, 13, 15, 1, 5, 15}, // G
+	{2433, 13, 15, 1, 5, 15}, // H
+	{2531, 2, 15, 2, 5, 6}, // I
+	{2546, 8, 15, 0, 5, 9}, // J
+	{2606, 12, 15, 2, 5, 14}, // K
+	{2696, 9, 15, 1, 5, 10}, // L
+	{2764, 16, 15, 1, 5, 18}, // M
+	{2884, 13, 15, 1, 5, 15}, // N
+	{2982, 14, 15, 1, 5, 16}, // O
+	{3087, 10, 15, 2, 5, 12}, // P
+	{3162, 15, 18, 1, 5, 16}, // Q
+	{3297, 11, 15, 2, 5, 13}, // R
+	{3380, 10, 15, 0, 5, 11}, // S
+	{3455, 12, 15, 0, 5, 12}, // T
+	{3545, 12, 15, 1, 5, 15}, // U
+	{3635, 14, 15, 0, 5, 14}, // V
+	{3740, 21, 15, 0, 5, 20}, // W
+	{3898, 13, 15, 0, 5, 13}, // X
+	{3996, 13, 15, 0, 5, 13}, // Y
+	{4094, 12, 15, 0, 5, 12}, // Z
+	{4184, 4, 19, 1, 4, 6}, // [
+	{4222, 9, 16, -1, 5, 8}, // 92
+	{4294, 4, 19, 1, 4, 6}, // ]
+	{4332, 9, 7, 1, 5, 12}, // ^
+	{4364, 8, 2, 0, 21, 8}, // _
+	{4372, 5, 3, 0, 5, 6}, // `
+	{4380, 8, 11, 1, 9, 10}, // a
+	{4424, 10, 15, 1, 5, 11}, // b
+	{4499, 9, 11, 0, 9, 9}, // c
+	{4549, 10, 15, 0, 5, 11}, // d
+	{4624, 10, 11, 0, 9, 10}, // e
+	{4679, 7, 15, 0, 5, 7}, // f
+	{4732, 10, 15, 0, 9, 10}, // g
+	{4807, 9, 15, 1, 5, 11}, // h
+	{4875, 3, 15, 1, 5, 5}, // i
+	{4898, 5, 19, -1, 5, 5}, // j
+	{4946, 9, 15, 1, 5, 10}, // k
+	{5014, 3, 15, 1, 5, 5}, // l
+	{5037, 15, 11, 1, 9, 16}, // m
+	{5120, 9, 11, 1, 9, 11}, // n
+	{5170, 11, 11, 0, 9, 11}, // o
+	{5231, 10, 15, 1, 9, 11}, // p
+	{5306, 10, 15, 0, 9, 11}, // q
+	{5381, 7, 11, 1, 9, 8}, // r
+	{5420, 8, 11, 0, 9, 9}, // s
+	{5464, 7, 14, 0, 6, 7}, // t
+	{5513, 9, 11, 1, 9, 11}, // u
+	{5563, 10, 11, 0, 9, 10}, // v
+	{5618, 16, 11, 0, 9, 15}, // w
+	{5706, 10, 11, 0, 9, 10}, // x
+	{5761, 10, 15, 0, 9, 10}, // y
+	{5836, 9, 11, 0, 9, 9}, // z
+	{5886, 5, 19, 0, 4, 6}, // {
+	{5934, 2, 20, 2, 4, 6}, // |
+	{5954, 5, 19, 1, 4, 6}, // }
+	{6002, 10, 4, 1, 12, 12}, // ~
+};
+const aKERN lato_20_kerning[402] = {
+	{34, 38, -2},
+	{34, 44, -2},
+	{34, 45, -2},
+	{34, 46, -2},
+	{34, 47, -2},
+	{34, 65, -2},
+	{34, 97, -1},
+	{34, 99, -1},
+	{34, 100, -1},
+	{34, 101, -1},
+	{34, 111, -1},
+	{34, 113, -1},
+	{39, 38, -2},
+	{39, 44, -2},
+	{39, 45, -2},
+	{39, 46, -2},
+	{39, 47, -2},
+	{39, 65, -2},
+	{39, 97, -1},
+	{39, 99, -1},
+	{39, 100, -1},
+	{39, 101, -1},
+	{39, 111, -1},
+	{39, 113, -1},
+	{42, 38, -2},
+	{42, 44, -2},
+	{42, 45, -2},
+	{42, 46, -2},
+	{42, 47, -2},
+	{42, 65, -2},
+	{42, 97, -1},
+	{42, 99, -1},
+	{42, 100, -1},
+	{42, 101, -1},
+	{42, 111, -1},
+	{42, 113, -1},
+	{44, 34, -2},
+	{44, 39, -2},
+	{44, 42, -2},
+	{44, 45, -1},
+	{44, 64, -1},
+	{44, 67, -1},
+	{44, 71, -1},
+	{44, 79, -1},
+	{44, 81, -1},
+	{44, 84, -2},
+	{44, 86, -2},
+	{44, 87, -1},
+	{44, 89, -2},
+	{44, 92, -2},
+	{44, 118, -1},
+	{44, 119, -1},
+	{44, 121, -1},
+	{45, 34, -2},
+	{45, 38, -1},
+	{45, 39, -2},
+	{45, 42, -2},
+	{45, 44, -1},
+	{45, 46, -1},
+	{45, 47, -1},
+	{45, 65, -1},
+	{45, 84, -2},
+	{45, 86, -1},
+	{45, 88, -1},
+	{45, 89, -2},
+	{45, 92, -1},
+	{46, 34, -2},
+	{46, 39, -2},
+	{46, 42, -2},
+	{46, 45, -1},
+	{46, 64, -1},
+	{46, 67, -1},
+	{46, 71, -1},
+	{46, 79, -1},
+	{46, 81, -1},
+	{46, 84, -2},
+	{46, 86, -2},
+	{46, 87, -1},
+	{46, 89, -2},
+	{46, 92, -2},
+	{46, 118, -1},
+	{46, 119, -1},
+	{46, 121, -1},
+	{47, 38, -1},
+	{47, 44, -2},
+	{47, 45, -1},
+	{47, 46, -2},
+	{47, 47, -1},
+	{47, 58, -1},
+	{47, 59, -1},
+	{47, 64, -1},
+	{47, 65, -1},
+	{47, 67, -1},
+	{47, 71, -1},
+	{47, 74, -2},
+	{47, 79, -1},
+	{47, 81, -1},
+	{47, 97, -1},
+	{47, 99, -1},
+	{47, 100, -1},
+	{47, 101, -1},
+	{47, 103, -1},
+	{47, 109, -1},
+	{47, 110, -1},
+	{47, 111, -1},
+	{47, 112, -1},
+	{47, 113, -1},
+	{47, 114, -1},
+	{47, 115, -1},
+	{47, 117, -1},
+	{47, 120, -1},
+	{47, 122, -1},
+	{64, 44, -1},
+	{64, 46, -1},
+	{64, 84, -1},
+	{64, 86, -1},
+	{64, 89, -1},
+	{64, 90, -1},
+	{64, 92, -1},
+	{65, 34, -2},
+	{65, 39, -2},
+	{65, 42, -2},
+	{65, 45, -1},
+	{65, 63, -1},
+	{65, 74, 1},
+	{65, 84, -1},
+	{65, 85, -1},
+	{65, 86, -1},
+	{65, 87, -1},
+	{65, 89, -2},
+	{65, 92, -1},
+	{65, 118, -1},
+	{65, 121, -1},
+	{67, 45, -1},
+	{68, 44, -1},
+	{68, 46, -1},
+	{68, 84, -1},
+	{68, 86, -1},
+	{68, 89, -1},
+	{68, 90, -1},
+	{68, 92, -1},
+	{70, 38, -1},
+	{70, 44, -2},
+	{70, 46, -2},
+	{70, 47, -1},
+	{70, 58, -1},
+	{70, 59, -1},
+	{70, 65, -1},
+	{70, 74, -2},
+	{70, 99, -1},
+	{70, 100, -1},
+	{70, 101, -1},
+	{70, 109, -1},
+	{70, 110, -1},
+	{70, 111, -1},
+	{70, 112, -1},
+	{70, 113, -1},
+	{70, 114, -1},
+	{70, 117, -1},
+	{74, 38, -1},
+	{74, 47, -1},
+	{74, 65, -1},
+	{75, 45, -1},
+	{75, 102, -1},
+	{75, 116, -1},
+	{75, 118, -1},
+	{75, 119, -1},
+	{75, 121, -1},
+	{76, 34, -3},
+	{76, 39, -3},
+	{76, 42, -3},
+	{76, 44, 1},
+	{76, 45, -2},
+	{76, 46, 1},
+	{76, 64, -1},
+	{76, 67, -1},
+	{76, 71, -1},
+	{76, 79, -1},
+	{76, 81, -1},
+	{76, 84, -2},
+	{76, 86, -2},
+	{76, 87, -2},
+	{76, 89, -2},
+	{76, 92, -2},
+	{76, 118, -1},
+	{76, 119, -1},
+	{76, 121, -1},
+	{79, 44, -1},
+	{79, 46, -1},
+	{79, 84, -1},
+	{79, 86, -1},
+	{79, 89, -1},
+	{79, 90, -1},
+	{79, 92, -1},
+	{80, 38, -1},
+	{80, 44, -2},
+	{80, 46, -2},
+	{80, 47, -1},
+	{80, 65, -1},
+	{80, 74, -2},
+	{81, 44, -1},
+	{81, 46, -1},
+	{81, 84, -1},
+	{81, 86, -1},
+	{81, 89, -1},
+	{81, 90, -1},
+	{81, 92, -1},
+	{82, 84, -1},
+	{84, 38, -1},
+	{84, 44, -2},
+	{84, 45, -2},
+	{84, 46, -2},
+	{84, 47, -1},
+	{84, 58, -2},
+	{84, 59, -2},
+	{84, 64, -1},
+	{84, 65, -1},
+	{84, 67, -1},
+	{84, 71, -1},
+	{84, 74, -2},
+	{84, 79, -1},
+	{84, 81, -1},
+	{84, 97, -2},
+	{84, 99, -2},
+	{84, 100, -2},
+	{84, 101, -2},
+	{84, 103, -2},
+	{84, 109, -2},
+	{84, 110, -2},
+	{84, 111, -2},
+	{84, 112, -2},
+	{84, 113, -2},
+	{84, 114, -2},
+	{84, 115, -2},
+	{84, 117, -2},
+	{84, 118, -2},
+	{84, 119, -1},
+	{84, 120, -1},
+	{84, 121, -2},
+	{84, 122, -1},
+	{85, 38, -1},
+	{85, 47, -1},
+	{85, 65, -1},
+	{86, 38, -1},
+	{86, 44, -2},
+	{86, 45, -1},
+	{86, 46, -2},
+	{86, 47, -1},
+	{86, 58, -1},
+	{86, 59, -1},
+	{86, 64, -1},
+	{86, 65, -1},
+	{86, 67, -1},
+	{86, 71, -1},
+	{86, 74, -2},
+	{86, 79, -1},
+	{86, 81, -1},
+	{86, 97, -1},
+	{86, 99, -1},
+	{86, 100, -1},
+	{86, 101, -1},
+	{86, 103, -1},
+	{86, 109, -1},
+	{86, 110, -1},
+	{86, 111, -1},
+	{86, 112, -1},
+	{86, 113, -1},
+	{86, 114, -1},
+	{86, 115, -1},
+	{86, 117, -1},
+	{86, 120, -1},
+	{86, 122, -1},
+	{87, 38, -1},
+	{87, 44, -1},
+	{87, 46, -1},
+	{87, 47, -1},
+	{87, 65, -1},
+	{87, 74, -1},
+	{87, 97, -1},
+	{87, 103, -1},
+	{88, 45, -1},
+	{88, 102, -1},
+	{88, 116, -1},
+	{88, 118, -1},
+	{88, 119, -1},
+	{88, 121, -1},
+	{89, 38, -2},
+	{89, 44, -2},
+	{89, 45, -2},
+	{89, 46, -2},
+	{89, 47, -2},
+	{89, 58, -1},
+	{89, 59, -1},
+	{89, 64, -1},
+	{89, 65, -2},
+	{89, 67, -1},
+	{89, 71, -1},
+	{89, 74, -2},
+	{89, 79, -1},
+	{89, 81, -1},
+	{89, 97, -1},
+	{89, 99, -2},
+	{89, 100, -2},
+	{89, 101, -2},
+	{89, 103, -2},
+	{89, 109, -1},
+	{89, 110, -1},
+	{89, 111, -2},
+	{89, 112, -1},
+	{89, 113, -2},
+	{89, 114, -1},
+	{89, 115, -1},
+	{89, 117, -1},
+	{89, 118, -1},
+	{89, 119, -1},
+	{89, 120, -1},
+	{89, 121, -1},
+	{90, 45, -1},
+	{90, 64, -1},
+	{90, 67, -1},
+	{90, 71, -1},
+	{90, 79, -1},
+	{90, 81, -1},
+	{92, 34, -2},
+	{92, 39, -2},
+	{92, 42, -2},
+	{92, 45, -1},
+	{92, 63, -1},
+	{92, 74, 1},
+	{92, 84, -1},
+	{92, 85, -1},
+	{92, 86, -1},
+	{92, 87, -1},
+	{92, 89, -2},
+	{92, 92, -1},
+	{92, 118, -1},
+	{92, 121, -1},
+	{97, 34, -1},
+	{97, 39, -1},
+	{97, 42, -1},
+	{98, 34, -1},
+	{98, 39, -1},
+	{98, 42, -1},
+	{98, 86, -1},
+	{98, 92, -1},
+	{98, 120, -1},
+	{101, 34, -1},
+	{101, 39, -1},
+	{101, 42, -1},
+	{101, 86, -1},
+	{101, 92, -1},
+	{101, 120, -1},
+	{102, 34, 1},
+	{102, 39, 1},
+	{102, 42, 1},
+	{102, 44, -1},
+	{102, 46, -1},
+	{104, 34, -1},
+	{104, 39, -1},
+	{104, 42, -1},
+	{107, 99, -1},
+	{107, 100, -1},
+	{107, 101, -1},
+	{107, 111, -1},
+	{107, 113, -1},
+	{109, 34, -1},
+	{109, 39, -1},
+	{109, 42, -1},
+	{110, 34, -1},
+	{110, 39, -1},
+	{110, 42, -1},
+	{111, 34, -1},
+	{111, 39, -1},
+	{111, 42, -1},
+	{111, 86, -1},
+	{111, 92, -1},
+	{111, 120, -1},
+	{112, 34, -1},
+	{112, 39, -1},
+	{112, 42, -1},
+	{112, 86, -1},
+	{112, 92, -1},
+	{112, 120, -1},
+	{114, 44, -1},
+	{114, 46, -1},
+	{118, 38, -1},
+	{118, 44, -1},
+	{118, 46, -1},
+	{118, 47, -1},
+	{118, 65, -1},
+	{119, 44, -1},
+	{119, 46, -1},
+	{120, 99, -1},
+	{120, 100, -1},
+	{120, 101, -1},
+	{120, 111, -1},
+	{120, 113, -1},
+	{121, 38, -1},
+	{121, 44, -1},
+	{121, 46, -1},
+	{121, 47, -1},
+	{121, 65, -1},
+};
+const aFONT lato_20 = {
+	lato_20_bitmap,
+	lato_20_glyphs,
+	lato_20_kerning,
+	402,
+	32,
+	126,
+	4,
+	24,
+};
+#endif
@@ -444,6 +444,147 @@ void Paint_DrawCircle(uint16_t X_Center, uint16_t Y_Center, uint16_t Radius,
     }
 }
 
+/******************************************************************************
+function: Build the color-pair lookup table used by the glyph blitter
+parameter:
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Each entry expands one nibble of a font row into 4 pixels, already in
+    the big-endian byte order Paint_SetPixel() uses for Scale 65, so a
+    whole font byte is copied as two 8 byte blocks. The table is only
+    rebuilt when the color pair changes.
+******************************************************************************/
+static uint8_t Glyph_LUT[16][8];
+static uint16_t Glyph_LUT_Foreground = BLACK;
+static uint16_t Glyph_LUT_Background = BLACK;
+static uint8_t Glyph_LUT_Valid = 0;
+
+static void Paint_SetGlyphColors(uint16_t Color_Foreground, uint16_t Color_Background)
+{
+    if (Glyph_LUT_Valid && Glyph_LUT_Foreground == Color_Foreground &&
+        Glyph_LUT_Background == Color_Background)
+        return;
+
+    for (uint8_t Nibble = 0; Nibble < 16; Nibble++) {
+        for (uint8_t Bit = 0; Bit < 4; Bit++) {
+            uint16_t Color = (Nibble & (0x08 >> Bit)) ? Color_Foreground : Color_Background;
+            Glyph_LUT[Nibble][Bit * 2] = 0xff & (Color >> 8);
+            Glyph_LUT[Nibble][Bit * 2 + 1] = 0xff & Color;
+        }
+    }
+
+    Glyph_LUT_Foreground = Color_Foreground;
+    Glyph_LUT_Background = Color_Background;
+    Glyph_LUT_Valid = 1;
+}
+
+/******************************************************************************
+function: Fill a horizontal span of pixels with one color
+parameter:
+    Addr   : Byte address of the first pixel in Paint.Image
+    Length : Number of pixels
+    Color  : Painted color
+info:
+    Only valid for Scale 65 images.
+******************************************************************************/
+static void Paint_FillSpan(uint32_t Addr, uint16_t Length, uint16_t Color)
+{
+    uint8_t High = 0xff & (Color >> 8);
+    uint8_t Low = 0xff & Color;
+    uint8_t *ptr = &Paint.Image[Addr];
+
+    while (Length--) {
+        *ptr++ = High;
+        *ptr++ = Low;
+    }
+}
+
+/******************************************************************************
+function: Draw a 1 bit glyph bitmap
+parameter:
+    Xpoint           : X coordinate
+    Ypoint           : Y coordinate
+    Glyph            : Glyph rows, MSB first, each row padded to a whole byte
+    Width            : Glyph width in pixels
+    Height           : Glyph height in pixels
+    Color_Foreground : Color of the set bits
+    Color_Background : Color of the clear bits
+    Transparent      : Leave the clear bits untouched
+info:
+    When the glyph lands unrotated and unclipped on an RGB565 image, whole
+    font bytes are expanded at once: through the color-pair table when
+    painting the background, or as runs of set bits when transparent.
+    Anything else falls back to Paint_SetPixel().
+******************************************************************************/
+static void Paint_DrawGlyph(uint16_t Xpoint, uint16_t Ypoint, const uint8_t *Glyph,
+                            uint16_t Width, uint16_t Height,
+                            uint16_t Color_Foreground, uint16_t Color_Background,
+                            uint8_t Transparent)
+{
+    uint16_t Page, Column;
+    uint16_t Width_Byte = Width / 8 + (Width % 8 ? 1 : 0);
+    const uint8_t *ptr = Glyph;
+
+    if (Paint.Scale != 65 || Paint.Rotate != ROTATE_0 || Paint.Mirror != MIRROR_NONE ||
+        Xpoint + Width > Paint.Width || Ypoint + Height > Paint.Height) {
+        for (Page = 0; Page < Height; Page ++ ) {
+            for (Column = 0; Column < Width; Column ++ ) {
+                if (ptr[Column / 8] & (0x80 >> (Column % 8)))
+                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
+                else if (!Transparent)
+                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Background);
+            }
+            ptr += Width_Byte;
+        }
+        return;
+    }
+
+    if (!Transparent)
+        Paint_SetGlyphColors(Color_Foreground, Color_Background);
+
+    uint32_t Addr = Xpoint * 2 + Ypoint * Paint.WidthByte;
+
+    for (Page = 0; Page < Height; Page ++ ) {
+        uint8_t *Row = &Paint.Image[Addr];
+
+        for (Column = 0; Column < Width; Column += 8) {
+            uint8_t Bits = *ptr++;
+            uint16_t Count = Width - Column < 8 ? Width - Column : 8;
+
+            if (!Transparent) {
+                if (Count == 8) {
+                    memcpy(Row, Glyph_LUT[Bits >> 4], 8);
+                    memcpy(Row + 8, Glyph_LUT[Bits & 0x0f], 8);
+                } else if (Count > 4) {
+                    memcpy(Row, Glyph_LUT[Bits >> 4], 8);
+                    memcpy(Row + 8, Glyph_LUT[Bits & 0x0f], (Count - 4) * 2);
+                } else {
+                    memcpy(Row, Glyph_LUT[Bits >> 4], Count * 2);
+                }
+            } else {
+                // Drop the padding bits, then fill each run of set bits
+                Bits &= 0xff << (8 - Count);
+                uint8_t Start, Bit = 0;
+                while (Bits) {
+                    while (!(Bits & 0x80)) {
+                        Bits <<= 1;
+                        Bit++;
+                    }
+                    Start = Bit;
+                    while (Bits & 0x80) {
+                        Bits <<= 1;
+                        Bit++;
+                    }
+                    Paint_FillSpan(Addr + (Column + Start) * 2, Bit - Start, Color_Foreground);
+                }
+            }
+            Row += 16;
+        }
+        Addr += Paint.WidthByte;
+    }
+}
+
 /******************************************************************************
 function: Show English characters
 parameter:
@@ -457,37 +598,42 @@ parameter:
 void Paint_DrawChar(uint16_t Xpoint, uint16_t Ypoint, const char Acsii_Char,
                     sFONT* Font, uint16_t Color_Foreground, uint16_t Color_Background)
 {
-    uint16_t Page, Column;
-
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
         Debug("Paint_DrawChar Input exceeds the normal display range\r\n");
         return;
     }
 
-    uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
-    const unsigned char *ptr = &Font->table[Char_Offset];
+    const uint8_t *Glyph = Font_GetGlyph(Font, Acsii_Char);
+    if (Glyph == NULL)
+        return;
 
-    for (Page = 0; Page < Font->Height; Page ++ ) {
-        for (Column = 0; Column < Font->Width; Column ++ ) {
+    Paint_DrawGlyph(Xpoint, Ypoint, Glyph, Font->Width, Font->Height,
+                    Color_Foreground, Color_Background, 0);
+}
 
-            // To determine whether the font background color and screen background color is consistent
-            if (*ptr & (0x80 >> (Column % 8)))
-            {
-                Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Background);
-                // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
-            else
-            {
-                Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
-            //One pixel is 8 bits
-            if (Column % 8 == 7)
-                ptr++;
-        }// Write a line
-        if (Font->Width % 8 != 0)
-            ptr++;
-    }// Write all
+/******************************************************************************
+function: Show English characters without painting the background
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Acsii_Char       ：To display the English characters
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+******************************************************************************/
+void Paint_DrawChar_Transparent(uint16_t Xpoint, uint16_t Ypoint, const char Acsii_Char,
+                                sFONT* Font, uint16_t Color_Foreground)
+{
+    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
+        Debug("Paint_DrawChar_Transparent Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    const uint8_t *Glyph = Font_GetGlyph(Font, Acsii_Char);
+    if (Glyph == NULL)
+        return;
+
+    Paint_DrawGlyph(Xpoint, Ypoint, Glyph, Font->Width, Font->Height,
+                    Color_Foreground, Color_Foreground, 1);
 }
 
 /******************************************************************************
@@ -523,7 +669,7 @@ void Paint_DrawString_EN(uint16_t Xstart, uint16_t Ystart, const char * pString,
             Xpoint = Xstart;
             Ypoint = Ystart;
         }
-        Paint_DrawChar(Xpoint, Ypoint, * pString, Font, Color_Background, Color_Foreground);
+        Paint_DrawChar(Xpoint, Ypoint, * pString, Font, Color_Foreground, Color_Background);
 
         //The next character of the address
         pString ++;
@@ -533,6 +679,236 @@ void Paint_DrawString_EN(uint16_t Xstart, uint16_t Ystart, const char * pString,
     }
 }
 
+/******************************************************************************
+function:	Display the string without painting the background
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The first address of the English string to be displayed
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+******************************************************************************/
+void Paint_DrawString_EN_Transparent(uint16_t Xstart, uint16_t Ystart, const char * pString,
+                                     sFONT* Font, uint16_t Color_Foreground)
+{
+    uint16_t Xpoint = Xstart;
+    uint16_t Ypoint = Ystart;
+
+    if (Xstart > Paint.Width || Ystart > Paint.Height) {
+        Debug("Paint_DrawString_EN_Transparent Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    while (* pString != '\0') {
+        if ((Xpoint + Font->Width ) > Paint.Width ) {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+
+        if ((Ypoint  + Font->Height ) > Paint.Height ) {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+        }
+        Paint_DrawChar_Transparent(Xpoint, Ypoint, * pString, Font, Color_Foreground);
+
+        pString ++;
+        Xpoint += Font->Width;
+    }
+}
+
+
+/******************************************************************************
+function: Build the alpha blend table used by anti-aliased text
+parameter:
+    Color : Text color
+    Bpp   : Bits of alpha per pixel in the font
+info:
+    Each alpha level is rescaled to 0 - 32 and the text color channels are
+    premultiplied by it, so blending one pixel costs three multiplies and
+    a shift. Rebuilt only when the color or the depth changes.
+******************************************************************************/
+static uint8_t AA_Alpha[16];
+static uint16_t AA_Red[16], AA_Green[16], AA_Blue[16];
+static uint16_t AA_LUT_Color = BLACK;
+static uint8_t AA_LUT_Bpp = 0;
+
+static void Paint_SetAlphaColor(uint16_t Color, uint8_t Bpp)
+{
+    if (AA_LUT_Bpp == Bpp && AA_LUT_Color == Color)
+        return;
+
+    uint8_t Max = (1 << Bpp) - 1;
+
+    for (uint8_t Level = 0; Level <= Max; Level++) {
+        uint8_t Alpha = (Level * 32 + Max / 2) / Max;
+        AA_Alpha[Level] = Alpha;
+        AA_Red[Level] = ((Color >> 11) & 0x1f) * Alpha;
+        AA_Green[Level] = ((Color >> 5) & 0x3f) * Alpha;
+        AA_Blue[Level] = (Color & 0x1f) * Alpha;
+    }
+
+    AA_LUT_Color = Color;
+    AA_LUT_Bpp = Bpp;
+}
+
+/******************************************************************************
+function: Draw one anti-aliased glyph
+parameter:
+    Xpoint : X coordinate of the bitmap, may be off screen
+    Ypoint : Y coordinate of the bitmap, may be off screen
+    Font   : A proportional anti-aliased font
+    Glyph  : Glyph to draw
+    Color  : Text color
+info:
+    Blends into unrotated RGB565 images. Anything else draws the pixels
+    above half coverage with Paint_SetPixel().
+******************************************************************************/
+static void Paint_DrawGlyph_AA(int16_t Xpoint, int16_t Ypoint, const aFONT* Font,
+                               const aGLYPH* Glyph, uint16_t Color)
+{
+    const uint8_t *ptr = &Font->bitmap[Glyph->offset];
+    uint8_t Bpp = Font->bpp;
+    uint8_t Max = (1 << Bpp) - 1;
+    uint8_t Fast = Paint.Scale == 65 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE;
+    uint8_t Bits = 0, Bit_Count = 0;
+
+    Paint_SetAlphaColor(Color, Bpp);
+
+    for (int16_t Y = Ypoint; Y < Ypoint + Glyph->height; Y++) {
+        for (int16_t X = Xpoint; X < Xpoint + Glyph->width; X++) {
+            if (Bit_Count == 0) {
+                Bits = *ptr++;
+                Bit_Count = 8;
+            }
+            Bit_Count -= Bpp;
+            uint8_t Level = (Bits >> Bit_Count) & Max;
+
+            if (Level == 0 || X < 0 || Y < 0 || X >= Paint.Width || Y >= Paint.Height)
+                continue;
+
+            if (!Fast) {
+                if (Level > Max / 2)
+                    Paint_SetPixel(X, Y, Color);
+                continue;
+            }
+
+            uint32_t Addr = X * 2 + Y * Paint.WidthByte;
+
+            if (Level == Max) {
+                Paint.Image[Addr] = 0xff & (Color >> 8);
+                Paint.Image[Addr + 1] = 0xff & Color;
+                continue;
+            }
+
+            uint16_t Background = (Paint.Image[Addr] << 8) | Paint.Image[Addr + 1];
+            uint8_t Inverse = 32 - AA_Alpha[Level];
+
+            // rounded, flooring darkens every edge by up to a step
+            uint16_t Red = (AA_Red[Level] + ((Background >> 11) & 0x1f) * Inverse + 16) >> 5;
+            uint16_t Green = (AA_Green[Level] + ((Background >> 5) & 0x3f) * Inverse + 16) >> 5;
+            uint16_t Blue = (AA_Blue[Level] + (Background & 0x1f) * Inverse + 16) >> 5;
+
+            uint16_t Blended = (Red << 11) | (Green << 5) | Blue;
+            Paint.Image[Addr] = 0xff & (Blended >> 8);
+            Paint.Image[Addr + 1] = 0xff & Blended;
+        }
+    }
+}
+
+/******************************************************************************
+function:	Display a string in a proportional anti-aliased font
+parameter:
+    Xstart           ：X coordinate of the pen
+    Ystart           ：Y coordinate of the top of the line
+    pString          ：The first address of the English string to be displayed
+    Font             ：A proportional anti-aliased font
+    Color_Foreground : Select the foreground color
+info:
+    Blends over whatever is already in the image and doesn't wrap.
+******************************************************************************/
+void Paint_DrawString_AA(uint16_t Xstart, uint16_t Ystart, const char * pString,
+                         const aFONT* Font, uint16_t Color_Foreground)
+{
+    int16_t Xpoint = Xstart;
+
+    while (* pString != '\0') {
+        const aGLYPH *Glyph = Font_GetGlyph_AA(Font, * pString);
+
+        if (Glyph != NULL) {
+            Paint_DrawGlyph_AA(Xpoint + Glyph->x_offset, Ystart + Glyph->y_offset,
+                               Font, Glyph, Color_Foreground);
+            Xpoint += Glyph->advance;
+        }
+
+        if (*(pString + 1) != '\0')
+            Xpoint += Font_GetKerning_AA(Font, * pString, *(pString + 1));
+
+        pString ++;
+    }
+}
+
+/******************************************************************************
+function:	Measure a string in a proportional anti-aliased font
+parameter:
+    pString ：The first address of the English string to be measured
+    Font    ：A proportional anti-aliased font
+info:
+    Sum of advances and kerning, use it to center text.
+******************************************************************************/
+uint16_t Paint_GetStringWidth_AA(const char * pString, const aFONT* Font)
+{
+    int16_t Width = 0;
+
+    while (* pString != '\0') {
+        const aGLYPH *Glyph = Font_GetGlyph_AA(Font, * pString);
+
+        if (Glyph != NULL)
+            Width += Glyph->advance;
+
+        if (*(pString + 1) != '\0')
+            Width += Font_GetKerning_AA(Font, * pString, *(pString + 1));
+
+        pString ++;
+    }
+
+    return Width < 0 ? 0 : Width;
+}
+
+/******************************************************************************
+function: Find a character in a GB2312 font
+parameter:
+    font : A structure pointer that displays a character size
+    Code : index[0] << 8 | index[1], index[1] is 0 for ASCII
+info:
+    Binary searches the generated index when the font has one, otherwise
+    scans the table. Returns NULL when the character is missing.
+******************************************************************************/
+static const CH_CN* Paint_FindChar_CN(cFONT* font, uint16_t Code)
+{
+    int Num;
+
+    if (font->lookup != NULL) {
+        int Low = 0, High = font->lookup_size - 1;
+        while (Low <= High) {
+            int Mid = (Low + High) / 2;
+            uint16_t Mid_Code = font->lookup[Mid].code;
+            if (Mid_Code == Code)
+                return &font->table[font->lookup[Mid].entry];
+            if (Mid_Code < Code)
+                Low = Mid + 1;
+            else
+                High = Mid - 1;
+        }
+        return NULL;
+    }
+
+    for(Num = 0; Num < font->size; Num++) {
+        if ((uint8_t)font->table[Num].index[0] == (Code >> 8) &&
+            ((Code & 0xff) == 0 || (uint8_t)font->table[Num].index[1] == (Code & 0xff)))
+            return &font->table[Num];
+    }
+    return NULL;
+}
 
 /******************************************************************************
 function: Display the string
@@ -548,79 +924,34 @@ parameter:
 void Paint_DrawString_CN(uint16_t Xstart, uint16_t Ystart, const char * pString, cFONT* font,
                         uint16_t Color_Foreground, uint16_t Color_Background)
 {
-    const char* p_text = pString;
+    const uint8_t* p_text = (const uint8_t*)pString;
     int x = Xstart, y = Ystart;
-    int i, j,Num;
+    const CH_CN* Char;
+
+    //this process is to speed up the scan
+    uint8_t Transparent = FONT_BACKGROUND == Color_Background;
 
     /* Send the string character by character on LCD */
     while (*p_text != 0) {
         if(*p_text <= 0x7F) {  //ASCII < 126
-            for(Num = 0; Num < font->size; Num++) {
-                if(*p_text== font->table[Num].index[0]) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
+            Char = Paint_FindChar_CN(font, *p_text << 8);
+            if (Char != NULL) {
+                Paint_DrawGlyph(x, y, (const uint8_t *)Char->matrix,
+                                font->Width, font->Height,
+                                Color_Foreground, Color_Background, Transparent);
             }
             /* Point on the next character */
             p_text += 1;
             /* Decrement the column position by 16 */
             x += font->ASCII_Width;
         } else {        //Chinese
-            for(Num = 0; Num < font->size; Num++) {
-                if((*p_text== font->table[Num].index[0]) && (*(p_text+1) == font->table[Num].index[1])) {
-                    const char* ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { //this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
+            if (*(p_text+1) == 0)
+                break;
+            Char = Paint_FindChar_CN(font, (*p_text << 8) | *(p_text+1));
+            if (Char != NULL) {
+                Paint_DrawGlyph(x, y, (const uint8_t *)Char->matrix,
+                                font->Width, font->Height,
+                                Color_Foreground, Color_Background, Transparent);
             }
             /* Point on the next character */
             p_text += 2;
@@ -658,6 +989,201 @@ void Paint_DrawNum(uint16_t Xpoint, uint16_t Ypoint, double Nummber,
     // pStr = NULL;
 }
 
+static const uint32_t Paint_Pow10[] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
+/******************************************************************************
+function:	Format a fraction, rounded half away from zero
+parameter:
+    Str         : Output, at least PAINT_NUM_LEN bytes
+    Numerator   : Dividend
+    Denominator : Divisor, 1 to 2 ^ 31
+    Digit       : Fractional width, at most 9
+info:
+    The integer and fractional parts are divided separately, so nothing
+    is multiplied by 10 ^ Digit before dividing and any int64 fits.
+******************************************************************************/
+static void Paint_FormatRatio(char *Str, int64_t Numerator, uint32_t Denominator, uint16_t Digit)
+{
+    char Digits[PAINT_NUM_LEN];
+    uint64_t Magnitude = Numerator < 0 ? -(uint64_t)Numerator : (uint64_t)Numerator;
+    uint64_t Whole = Magnitude / Denominator;
+    // the remainder is below 2 ^ 31, times 10 ^ 9 still fits
+    uint64_t Frac = ((Magnitude % Denominator) * Paint_Pow10[Digit] + Denominator / 2) / Denominator;
+    uint8_t Count = 0;
+
+    if (Frac == Paint_Pow10[Digit]) {
+        Whole++;
+        Frac = 0;
+    }
+
+    // no -0.000
+    if (Numerator < 0 && (Whole != 0 || Frac != 0))
+        *Str++ = '-';
+
+    for (uint8_t i = 0; i < Digit; i++) {
+        Digits[Count++] = '0' + Frac % 10;
+        Frac /= 10;
+    }
+    do {
+        Digits[Count++] = '0' + Whole % 10;
+        Whole /= 10;
+    } while (Whole != 0);
+
+    while (Count > 0) {
+        *Str++ = Digits[--Count];
+        if (Count == Digit && Digit != 0)
+            *Str++ = '.';
+    }
+    *Str = '\0';
+}
+
+/******************************************************************************
+function:	Format a fixed point number
+parameter:
+    Str       : Output, at least PAINT_NUM_LEN bytes
+    Nummber   : The number, Frac_Bits of it fractional, 16 for Q16.16
+    Frac_Bits : Fractional bits, at most 31
+    Digit     : Fractional width, at most 9
+******************************************************************************/
+void Paint_FormatNum_Fixed(char *Str, int32_t Nummber, uint8_t Frac_Bits, uint16_t Digit)
+{
+    if (Digit > 9)
+        Digit = 9;
+    if (Frac_Bits > 31)
+        Frac_Bits = 31;
+    Paint_FormatRatio(Str, Nummber, (uint32_t)1 << Frac_Bits, Digit);
+}
+
+/******************************************************************************
+function:	Format a number given in thousandths
+parameter:
+    Str     : Output, at least PAINT_NUM_LEN bytes
+    Nummber : The number times 1000
+    Digit   : Fractional width, at most 9
+******************************************************************************/
+void Paint_FormatNum_Milli(char *Str, int32_t Nummber, uint16_t Digit)
+{
+    if (Digit > 9)
+        Digit = 9;
+    Paint_FormatRatio(Str, Nummber, 1000, Digit);
+}
+
+/******************************************************************************
+function:	Format a raw sensor reading
+parameter:
+    Str       : Output, at least PAINT_NUM_LEN bytes
+    Raw       : Reading in LSB
+    Scale_Num : The number is Raw * Scale_Num / Scale_Den
+    Scale_Den : Positive
+    Digit     : Fractional width, at most 9
+******************************************************************************/
+void Paint_FormatNum_Scaled(char *Str, int32_t Raw, int32_t Scale_Num, int32_t Scale_Den, uint16_t Digit)
+{
+    if (Digit > 9)
+        Digit = 9;
+    Paint_FormatRatio(Str, (int64_t)Raw * Scale_Num, Scale_Den, Digit);
+}
+
+/******************************************************************************
+function:	Display a fixed point number without floating point
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           : Y coordinate
+    Nummber          : The number, Frac_Bits of it fractional, 16 for Q16.16
+    Frac_Bits        : Fractional bits
+    Font             ：A structure pointer that displays a character size
+    Digit			 : Fractional width
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawNum_Fixed(uint16_t Xpoint, uint16_t Ypoint, int32_t Nummber, uint8_t Frac_Bits,
+                         sFONT *Font, uint16_t Digit, uint16_t Color_Foreground, uint16_t Color_Background)
+{
+    char Str[PAINT_NUM_LEN];
+    Paint_FormatNum_Fixed(Str, Nummber, Frac_Bits, Digit);
+    Paint_DrawString_EN(Xpoint, Ypoint, Str, Font, Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function:	Display a number given in thousandths without floating point
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           : Y coordinate
+    Nummber          : The number times 1000
+    Font             ：A structure pointer that displays a character size
+    Digit			 : Fractional width
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawNum_Milli(uint16_t Xpoint, uint16_t Ypoint, int32_t Nummber,
+                         sFONT *Font, uint16_t Digit, uint16_t Color_Foreground, uint16_t Color_Background)
+{
+    char Str[PAINT_NUM_LEN];
+    Paint_FormatNum_Milli(Str, Nummber, Digit);
+    Paint_DrawString_EN(Xpoint, Ypoint, Str, Font, Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function:	Display a raw sensor reading without floating point
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           : Y coordinate
+    Raw              : Reading in LSB
+    Scale_Num        : The number is Raw * Scale_Num / Scale_Den
+    Scale_Den        : Positive
+    Font             ：A structure pointer that displays a character size
+    Digit			 : Fractional width
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_DrawNum_Scaled(uint16_t Xpoint, uint16_t Ypoint, int32_t Raw, int32_t Scale_Num, int32_t Scale_Den,
+                          sFONT *Font, uint16_t Digit, uint16_t Color_Foreground, uint16_t Color_Background)
+{
+    char Str[PAINT_NUM_LEN];
+    Paint_FormatNum_Scaled(Str, Raw, Scale_Num, Scale_Den, Digit);
+    Paint_DrawString_EN(Xpoint, Ypoint, Str, Font, Color_Foreground, Color_Background);
+}
+
+/******************************************************************************
+function:	Display a string, redrawing only the characters that changed
+parameter:
+    Xstart           ：X coordinate
+    Ystart           ：Y coordinate
+    pString          ：The string, shorter than PAINT_NUM_LEN
+    Last             ：What was drawn here last time, zeroed before first use
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+info:
+    Meant for numbers updated every frame, no wrapping. Characters left
+    over from a longer previous string are cleared to the background.
+******************************************************************************/
+void Paint_DrawString_EN_Changed(uint16_t Xstart, uint16_t Ystart, const char * pString, PAINT_NUM *Last,
+                                 sFONT* Font, uint16_t Color_Foreground, uint16_t Color_Background)
+{
+    uint8_t i, Ended = 0, Last_Ended = 0;
+
+    for (i = 0; i < PAINT_NUM_LEN - 1; i++) {
+        if (pString[i] == '\0')
+            Ended = 1;
+        if (Last->Text[i] == '\0')
+            Last_Ended = 1;
+        if (Ended && Last_Ended)
+            break;
+
+        char Char = Ended ? ' ' : pString[i];
+        char Last_Char = Last_Ended ? ' ' : Last->Text[i];
+
+        if (Char != Last_Char || Last_Ended)
+            Paint_DrawChar(Xstart + i * Font->Width, Ystart, Char, Font, Color_Foreground, Color_Background);
+
+        Last->Text[i] = Ended ? '\0' : Char;
+    }
+    Last->Text[i] = '\0';
+}
+
 /******************************************************************************
 function:	Display time
 parameter:
@@ -676,14 +1202,14 @@ void Paint_DrawTime(uint16_t Xstart, uint16_t Ystart, PAINT_TIME *pTime, sFONT*
     uint16_t Dx = Font->Width;
 
     //Write data into the cache
-    Paint_DrawChar(Xstart                           , Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx                      , Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx  + Dx / 4 + Dx / 2   , Ystart, ':'                    , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 2 + Dx / 2         , Ystart, value[pTime->Min / 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 3 + Dx / 2         , Ystart, value[pTime->Min % 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':'                    , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 5                  , Ystart, value[pTime->Sec / 10] , Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 6                  , Ystart, value[pTime->Sec % 10] , Font, Color_Background, Color_Foreground);
+    Paint_DrawChar(Xstart                           , Ystart, value[pTime->Hour / 10], Font, Color_Foreground, Color_Background);
+    Paint_DrawChar(Xstart + Dx                      , Ystart, value[pTime->Hour % 10], Font, Color_Foreground, Color_Background);
+    Paint_DrawChar(Xstart + Dx  + Dx / 4 + Dx / 2   , Ystart, ':'                    , Font, Color_Foreground, Color_Background);
+    Paint_DrawChar(Xstart + Dx * 2 + Dx / 2         , Ystart, value[pTime->Min / 10] , Font, Color_Foreground, Color_Background);
+    Paint_DrawChar(Xstart + Dx * 3 + Dx / 2         , Ystart, value[pTime->Min % 10] , Font, Color_Foreground, Color_Background);
+    Paint_DrawChar(Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':'                    , Font, Color_Foreground, Color_Background);
+    Paint_DrawChar(Xstart + Dx * 5                  , Ystart, value[pTime->Sec / 10] , Font, Color_Foreground, Color_Background);
+    Paint_DrawChar(Xstart + Dx * 6                  , Ystart, value[pTime->Sec % 10] , Font, Color_Foreground, Color_Background);
     
 }
 
@@ -716,6 +1242,227 @@ void Paint_DrawImage1(const unsigned char *image, uint16_t xStart, uint16_t ySta
 		} 
 }
 
+/******************************************************************************
+function:	Sine of a binary angle
+parameter:
+    Angle : ANGLE_FULL_TURN steps per turn
+info:
+    Returns Q16.16, 65536 is 1.0. Quarter wave table, no floating point.
+******************************************************************************/
+static const int32_t Paint_Sine_Table[ANGLE_FULL_TURN / 4 + 1] = {
+    0, 402, 804, 1206, 1608, 2010, 2412, 2814, 3216, 3617, 4019, 4420,
+    4821, 5222, 5623, 6023, 6424, 6824, 7224, 7623, 8022, 8421, 8820, 9218,
+    9616, 10014, 10411, 10808, 11204, 11600, 11996, 12391, 12785, 13180, 13573, 13966,
+    14359, 14751, 15143, 15534, 15924, 16314, 16703, 17091, 17479, 17867, 18253, 18639,
+    19024, 19409, 19792, 20175, 20557, 20939, 21320, 21699, 22078, 22457, 22834, 23210,
+    23586, 23961, 24335, 24708, 25080, 25451, 25821, 26190, 26558, 26925, 27291, 27656,
+    28020, 28383, 28745, 29106, 29466, 29824, 30182, 30538, 30893, 31248, 31600, 31952,
+    32303, 32652, 33000, 33347, 33692, 34037, 34380, 34721, 35062, 35401, 35738, 36075,
+    36410, 36744, 37076, 37407, 37736, 38064, 38391, 38716, 39040, 39362, 39683, 40002,
+    40320, 40636, 40951, 41264, 41576, 41886, 42194, 42501, 42806, 43110, 43412, 43713,
+    44011, 44308, 44604, 44898, 45190, 45480, 45769, 46056, 46341, 46624, 46906, 47186,
+    47464, 47741, 48015, 48288, 48559, 48828, 49095, 49361, 49624, 49886, 50146, 50404,
+    50660, 50914, 51166, 51417, 51665, 51911, 52156, 52398, 52639, 52878, 53114, 53349,
+    53581, 53812, 54040, 54267, 54491, 54714, 54934, 55152, 55368, 55582, 55794, 56004,
+    56212, 56418, 56621, 56823, 57022, 57219, 57414, 57607, 57798, 57986, 58172, 58356,
+    58538, 58718, 58896, 59071, 59244, 59415, 59583, 59750, 59914, 60075, 60235, 60392,
+    60547, 60700, 60851, 60999, 61145, 61288, 61429, 61568, 61705, 61839, 61971, 62101,
+    62228, 62353, 62476, 62596, 62714, 62830, 62943, 63054, 63162, 63268, 63372, 63473,
+    63572, 63668, 63763, 63854, 63944, 64031, 64115, 64197, 64277, 64354, 64429, 64501,
+    64571, 64639, 64704, 64766, 64827, 64884, 64940, 64993, 65043, 65091, 65137, 65180,
+    65220, 65259, 65294, 65328, 65358, 65387, 65413, 65436, 65457, 65476, 65492, 65505,
+    65516, 65525, 65531, 65535, 65536,
+};
+
+int32_t Paint_Sin(int16_t Angle)
+{
+    uint16_t Index = Angle & (ANGLE_FULL_TURN - 1);
+    uint16_t Quarter = ANGLE_FULL_TURN / 4;
+
+    if (Index < Quarter)
+        return Paint_Sine_Table[Index];
+    if (Index < Quarter * 2)
+        return Paint_Sine_Table[Quarter * 2 - Index];
+    if (Index < Quarter * 3)
+        return -Paint_Sine_Table[Index - Quarter * 2];
+    return -Paint_Sine_Table[Quarter * 4 - Index];
+}
+
+int32_t Paint_Cos(int16_t Angle)
+{
+    return Paint_Sin(Angle + ANGLE_FULL_TURN / 4);
+}
+
+/******************************************************************************
+function:	Set up a rotation and zoom for Paint_DrawImage_Affine
+parameter:
+    Affine   : Output
+    Angle    : Clockwise, ANGLE_FULL_TURN steps per turn
+    Zoom     : Q16.16, 65536 draws the image 1:1
+    X_Image  : Image pixel that lands on X_Center, Y_Center
+    Y_Image  :
+    X_Center : Screen pixel the image turns around
+    Y_Center :
+******************************************************************************/
+void Paint_SetAffine(PAINT_AFFINE *Affine, int16_t Angle, int32_t Zoom,
+                     int16_t X_Image, int16_t Y_Image, int16_t X_Center, int16_t Y_Center)
+{
+    if (Zoom < PAINT_ZOOM_MIN)
+        Zoom = PAINT_ZOOM_MIN;
+
+    // inverse mapping, screen to image, so every screen pixel is written once
+    int32_t Cos = (int64_t)Paint_Cos(Angle) * 65536 / Zoom;
+    int32_t Sin = (int64_t)Paint_Sin(Angle) * 65536 / Zoom;
+
+    Affine->Du_Dx = Cos;
+    Affine->Dv_Dx = -Sin;
+    Affine->Du_Dy = Sin;
+    Affine->Dv_Dy = Cos;
+
+    // pixel centers line up, hence the extra half pixel on the image side
+    Affine->U0 = X_Image * 65536 + 0x8000 - X_Center * Cos - Y_Center * Sin;
+    Affine->V0 = Y_Image * 65536 + 0x8000 + X_Center * Sin - Y_Center * Cos;
+}
+
+/******************************************************************************
+function:	Floor division, clamped to the int16_t range
+******************************************************************************/
+static int32_t Paint_FloorDiv(int64_t Numerator, int64_t Denominator)
+{
+    int64_t Quotient = Numerator / Denominator;
+    if ((Numerator % Denominator != 0) && ((Numerator < 0) != (Denominator < 0)))
+        Quotient--;
+    if (Quotient > INT16_MAX)
+        return INT16_MAX;
+    if (Quotient < -INT16_MAX)
+        return -INT16_MAX;
+    return Quotient;
+}
+
+/******************************************************************************
+function:	Narrow a span of x so that Start + x * Step stays in [0, Limit)
+parameter:
+    Start : Q16.16 coordinate at x = 0
+    Step  : Q16.16 step per x
+    Limit : Q16.16 bound
+    X_Min : In and out, inclusive
+    X_Max : In and out, inclusive
+******************************************************************************/
+static void Paint_ClipSpan(int32_t Start, int32_t Step, int32_t Limit, int16_t *X_Min, int16_t *X_Max)
+{
+    int32_t Low, High;
+
+    if (Step == 0) {
+        if (Start < 0 || Start >= Limit)
+            *X_Max = *X_Min - 1;
+        return;
+    }
+
+    // ceil(a / b) is -floor(a / -b)
+    if (Step > 0) {
+        Low = -Paint_FloorDiv(Start, Step);
+        High = Paint_FloorDiv((int64_t)Limit - 1 - Start, Step);
+    } else {
+        Low = -Paint_FloorDiv((int64_t)Limit - 1 - Start, -(int64_t)Step);
+        High = Paint_FloorDiv(-(int64_t)Start, Step);
+    }
+
+    if (Low > *X_Min)
+        *X_Min = Low;
+    if (High < *X_Max)
+        *X_Max = High;
+}
+
+/******************************************************************************
+function:	Blend two RGB565 colors spread out as 0x07E0F81F
+parameter:
+    A, B   : Spread colors
+    Weight : 0 gives A, 32 gives B
+******************************************************************************/
+static inline uint32_t Paint_LerpSpread(uint32_t A, uint32_t B, uint32_t Weight)
+{
+    return ((A * (32 - Weight) + B * Weight) >> 5) & 0x07E0F81F;
+}
+
+static inline uint32_t Paint_Spread(const unsigned char *Pixel)
+{
+    uint32_t Color = Pixel[1] << 8 | Pixel[0];
+    return (Color | Color << 16) & 0x07E0F81F;
+}
+
+/******************************************************************************
+function:	Draw an image rotated, scaled and moved
+parameter:
+    image   : RGB565, low byte first, same as Paint_DrawImage
+    W_Image : Image width
+    H_Image : Image height
+    Affine  : From Paint_SetAffine, or filled in by hand
+    Filter  : IMAGE_FILTER_NEAREST or IMAGE_FILTER_BILINEAR
+info:
+    Only screen pixels the image covers are written, clear first if the
+    image moves. Each row works out its covered span once, so the inner
+    loop is just two adds and a fetch.
+******************************************************************************/
+void Paint_DrawImage_Affine(const unsigned char *image, uint16_t W_Image, uint16_t H_Image,
+                            const PAINT_AFFINE *Affine, IMAGE_FILTER Filter)
+{
+    int32_t Limit_U = (int32_t)W_Image << 16;
+    int32_t Limit_V = (int32_t)H_Image << 16;
+    uint8_t Fast = Paint.Scale == 65 && Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE;
+
+    for (int16_t y = 0; y < Paint.Height; y++) {
+        int32_t U_Row = Affine->U0 + y * Affine->Du_Dy;
+        int32_t V_Row = Affine->V0 + y * Affine->Dv_Dy;
+
+        int16_t X_Min = 0, X_Max = Paint.Width - 1;
+        Paint_ClipSpan(U_Row, Affine->Du_Dx, Limit_U, &X_Min, &X_Max);
+        Paint_ClipSpan(V_Row, Affine->Dv_Dx, Limit_V, &X_Min, &X_Max);
+        if (X_Min > X_Max)
+            continue;
+
+        int32_t U = U_Row + X_Min * Affine->Du_Dx;
+        int32_t V = V_Row + X_Min * Affine->Dv_Dx;
+        uint8_t *Out = &Paint.Image[X_Min * 2 + y * Paint.WidthByte];
+
+        for (int16_t x = X_Min; x <= X_Max; x++) {
+            uint16_t Color;
+
+            if (Filter == IMAGE_FILTER_BILINEAR) {
+                // between the four nearest pixel centers, edges clamp
+                int32_t Us = U - 0x8000, Vs = V - 0x8000;
+                int16_t X0 = Us >> 16, Y0 = Vs >> 16;
+                int16_t X1 = X0 + 1, Y1 = Y0 + 1;
+                uint8_t Fx = (Us >> 11) & 0x1f, Fy = (Vs >> 11) & 0x1f;
+                if (X0 < 0) X0 = 0;
+                if (Y0 < 0) Y0 = 0;
+                if (X1 >= W_Image) X1 = W_Image - 1;
+                if (Y1 >= H_Image) Y1 = H_Image - 1;
+
+                const unsigned char *Row0 = image + Y0 * W_Image * 2;
+                const unsigned char *Row1 = image + Y1 * W_Image * 2;
+                uint32_t Top = Paint_LerpSpread(Paint_Spread(Row0 + X0 * 2), Paint_Spread(Row0 + X1 * 2), Fx);
+                uint32_t Bottom = Paint_LerpSpread(Paint_Spread(Row1 + X0 * 2), Paint_Spread(Row1 + X1 * 2), Fx);
+                uint32_t Spread = Paint_LerpSpread(Top, Bottom, Fy);
+                Color = Spread | Spread >> 16;
+            } else {
+                const unsigned char *Pixel = image + ((V >> 16) * W_Image + (U >> 16)) * 2;
+                Color = Pixel[1] << 8 | Pixel[0];
+            }
+
+            if (Fast) {
+                Out[0] = Color >> 8;
+                Out[1] = Color;
+                Out += 2;
+            } else {
+                Paint_SetPixel(x, y, Color);
+            }
+
+            U += Affine->Du_Dx;
+            V += Affine->Dv_Dx;
+        }
+    }
+}
+
 /******************************************************************************
 function:	Display monochrome bitmap
 parameter:
@@ -116,6 +116,34 @@ typedef struct {
 } PAINT_TIME;
 extern PAINT_TIME sPaint_time;
 
+/**
+ * Last string drawn by Paint_DrawString_EN_Changed, long enough for any
+ * Paint_FormatNum_* output
+**/
+#define PAINT_NUM_LEN 32
+typedef struct {
+    char Text[PAINT_NUM_LEN];
+} PAINT_NUM;
+
+/**
+ * Image sampling for Paint_DrawImage_Affine
+**/
+typedef enum {
+    IMAGE_FILTER_NEAREST = 0,
+    IMAGE_FILTER_BILINEAR,
+} IMAGE_FILTER;
+
+/**
+ * Screen to image mapping, Q16.16 image pixels
+**/
+#define ANGLE_FULL_TURN     1024
+#define PAINT_ZOOM_MIN      (65536 / 16)
+typedef struct {
+    int32_t U0, V0;         // image position of screen pixel 0, 0
+    int32_t Du_Dx, Dv_Dx;   // step per screen pixel to the right
+    int32_t Du_Dy, Dv_Dy;   // step per screen row down
+} PAINT_AFFINE;
+
 //init and Clear
 void Paint_NewImage(uint8_t *image, uint16_t Width, uint16_t Height, uint16_t Rotate, uint16_t Color);
 void Paint_SelectImage(uint8_t *image);
@@ -135,9 +163,20 @@ void Paint_DrawCircle(uint16_t X_Center, uint16_t Y_Center, uint16_t Radius, uin
 
 //Display string
 void Paint_DrawChar(uint16_t Xstart, uint16_t Ystart, const char Acsii_Char, sFONT* Font, uint16_t Color_Foreground, uint16_t Color_Background);
+void Paint_DrawChar_Transparent(uint16_t Xstart, uint16_t Ystart, const char Acsii_Char, sFONT* Font, uint16_t Color_Foreground);
 void Paint_DrawString_EN(uint16_t Xstart, uint16_t Ystart, const char * pString, sFONT* Font, uint16_t Color_Foreground, uint16_t Color_Background);
+void Paint_DrawString_EN_Transparent(uint16_t Xstart, uint16_t Ystart, const char * pString, sFONT* Font, uint16_t Color_Foreground);
+void Paint_DrawString_AA(uint16_t Xstart, uint16_t Ystart, const char * pString, const aFONT* Font, uint16_t Color_Foreground);
+uint16_t Paint_GetStringWidth_AA(const char * pString, const aFONT* Font);
 void Paint_DrawString_CN(uint16_t Xstart, uint16_t Ystart, const char * pString, cFONT* font, uint16_t Color_Foreground, uint16_t Color_Background);
 void Paint_DrawNum(uint16_t Xpoint, uint16_t Ypoint, double Nummber, sFONT* Font, uint16_t Digit,uint16_t Color_Foreground, uint16_t Color_Background);
+void Paint_DrawNum_Fixed(uint16_t Xpoint, uint16_t Ypoint, int32_t Nummber, uint8_t Frac_Bits, sFONT* Font, uint16_t Digit, uint16_t Color_Foreground, uint16_t Color_Background);
+void Paint_DrawNum_Milli(uint16_t Xpoint, uint16_t Ypoint, int32_t Nummber, sFONT* Font, uint16_t Digit, uint16_t Color_Foreground, uint16_t Color_Background);
+void Paint_DrawNum_Scaled(uint16_t Xpoint, uint16_t Ypoint, int32_t Raw, int32_t Scale_Num, int32_t Scale_Den, sFONT* Font, uint16_t Digit, uint16_t Color_Foreground, uint16_t Color_Background);
+void Paint_FormatNum_Fixed(char *Str, int32_t Nummber, uint8_t Frac_Bits, uint16_t Digit);
+void Paint_FormatNum_Milli(char *Str, int32_t Nummber, uint16_t Digit);
+void Paint_FormatNum_Scaled(char *Str, int32_t Raw, int32_t Scale_Num, int32_t Scale_Den, uint16_t Digit);
+void Paint_DrawString_EN_Changed(uint16_t Xstart, uint16_t Ystart, const char * pString, PAINT_NUM *Last, sFONT* Font, uint16_t Color_Foreground, uint16_t Color_Background);
 void Paint_DrawTime(uint16_t Xstart, uint16_t Ystart, PAINT_TIME *pTime, sFONT* Font, uint16_t Color_Foreground, uint16_t Color_Background);
 
 //pic
@@ -145,6 +184,10 @@ void Paint_DrawBitMap(const unsigned char* image_buffer);
 void Paint_DrawBitMap_Block(const unsigned char* image_buffer, uint8_t Region);
 
 void Paint_DrawImage(const unsigned char *image, uint16_t xStart, uint16_t yStart, uint16_t W_Image, uint16_t H_Image) ;
+int32_t Paint_Sin(int16_t Angle);
+int32_t Paint_Cos(int16_t Angle);
+void Paint_SetAffine(PAINT_AFFINE *Affine, int16_t Angle, int32_t Zoom, int16_t X_Image, int16_t Y_Image, int16_t X_Center, int16_t Y_Center);
+void Paint_DrawImage_Affine(const unsigned char *image, uint16_t W_Image, uint16_t H_Image, const PAINT_AFFINE *Affine, IMAGE_FILTER Filter);
 void Paint_DrawImage1(const unsigned char *image, uint16_t xStart, uint16_t yStart, uint16_t W_Image, uint16_t H_Image);
  void Paint_BmpWindows(unsigned char x,unsigned char y,const unsigned char *pBmp,\
 					unsigned char chWidth,unsigned char chHeight);
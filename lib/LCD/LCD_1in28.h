@@ -42,6 +42,7 @@ function:
 ********************************************************************************/
 void LCD_1IN28_Init(uint8_t Scan_dir);
 void LCD_1IN28_Clear(uint16_t Color);
+void LCD_1IN28_SetWindows(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend);
 void LCD_1IN28_Display(uint16_t *Image);
 void LCD_1IN28_DisplayWindows(uint16_t Xstart, uint16_t Ystart, uint16_t Xend, uint16_t Yend, uint16_t *Image);
 void LCD_1IN28_DisplayPoint(uint16_t X, uint16_t Y, uint16_t Color);
@@ -297,6 +297,18 @@ unsigned char QMI8658_readStatus1(void)
 	return status;
 }
 
+// raw readings per g and per dps, for scaling QMI8658_read_xyz_raw
+// without going through float
+unsigned short QMI8658_get_acc_lsb_div(void)
+{
+	return acc_lsb_div;
+}
+
+unsigned short QMI8658_get_gyro_lsb_div(void)
+{
+	return gyro_lsb_div;
+}
+
 float QMI8658_readTemp(void)
 {
 	unsigned char buf[2];
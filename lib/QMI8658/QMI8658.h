@@ -484,6 +484,8 @@ extern void QMI8658_read_ae(float quat[4], float velocity[3]);
 extern unsigned char QMI8658_readStatus0(void);
 extern unsigned char QMI8658_readStatus1(void);
 extern float QMI8658_readTemp(void);
+extern unsigned short QMI8658_get_acc_lsb_div(void);
+extern unsigned short QMI8658_get_gyro_lsb_div(void);
 extern void QMI8658_enableWakeOnMotion(void);
 extern void QMI8658_disableWakeOnMotion(void);
 
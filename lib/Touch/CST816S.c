@@ -64,8 +64,8 @@ void CST816S_Set_Mode(uint8_t mode)
 {
     if (mode == CST816S_Point_Mode)
     {
-        // 
-        CST816S_I2C_Write(CST816_IrqCtl, 0x41);
+        // EnTouch repeats while held, EnChange adds one on release
+        CST816S_I2C_Write(CST816_IrqCtl, 0x61);
         
     }
     else if (mode == CST816S_Gesture_Mode)
@@ -114,16 +114,13 @@ uint8_t CST816S_init(uint8_t mode)
 
 CST816S CST816S_Get_Point()
 {
-    uint8_t x_point_h, x_point_l, y_point_h, y_point_l;
+    CST816S_Touch touch;
     // CST816S_Wake_up();
 
-    x_point_h = CST816S_I2C_Read(CST816_XposH);
-    x_point_l = CST816S_I2C_Read(CST816_XposL);
-    y_point_h = CST816S_I2C_Read(CST816_YposH);
-    y_point_l = CST816S_I2C_Read(CST816_YposL);
+    CST816S_Read_Touch(&touch);
 
-    Touch_CTS816.x_point = ((x_point_h & 0x0f) << 8) + x_point_l;
-    Touch_CTS816.y_point = ((y_point_h & 0x0f) << 8) + y_point_l;
+    Touch_CTS816.x_point = touch.x_point;
+    Touch_CTS816.y_point = touch.y_point;
 
     return Touch_CTS816;
 }
@@ -132,4 +129,23 @@ uint8_t CST816S_Get_Gesture(void)
     uint8_t gesture;
     gesture=CST816S_I2C_Read(CST816_GestureID);
     return gesture;
-}
\ No newline at end of file
+}
+
+/******************************************************************************
+function :	Read gesture, finger count and position in one transaction
+parameter:
+	touch :   Filled from registers 0x01 to 0x06
+Info:
+	The registers are consecutive, so one 6 byte burst replaces a
+	transaction per register and the values all come from the same scan
+******************************************************************************/
+void CST816S_Read_Touch(CST816S_Touch *touch)
+{
+    uint8_t data[6];
+    DEV_I2C_Read_nByte(SENSOR_I2C_PORT, CST816_ADDR, CST816_GestureID, data, 6);
+
+    touch->gesture = data[0];
+    touch->fingers = data[1];
+    touch->x_point = ((data[2] & 0x0f) << 8) + data[3];
+    touch->y_point = ((data[4] & 0x0f) << 8) + data[5];
+}
@@ -88,10 +88,22 @@ typedef struct
 	CST816S_Mode mode;
 } CST816S;
 
+/**
+ * Everything from one burst read
+ **/
+typedef struct
+{
+	uint8_t gesture;
+	uint8_t fingers;
+	uint16_t x_point;
+	uint16_t y_point;
+} CST816S_Touch;
+
 extern CST816S Touch_CTS816;
 
 uint8_t CST816S_init(uint8_t mode);
 CST816S CST816S_Get_Point();
 uint8_t CST816S_Get_Gesture(void);
+void CST816S_Read_Touch(CST816S_Touch *touch);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,210 @@
+#include "asset_cache.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "maki_huffman_decode.h"
+
+void assetCacheInit(AssetCache* cache, const Asset* assets,
+                    uint8_t assetCount, uint32_t budget) {
+	cache->assets = assets;
+	cache->assetCount = assetCount;
+	cache->budget = budget;
+	cache->used = 0;
+	cache->clock = 0;
+	cache->prefetch = ASSET_CACHE_NONE;
+	cache->decoding = ASSET_CACHE_NONE;
+
+	for (uint8_t i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+		cache->entries[i].id = ASSET_CACHE_NONE;
+		cache->entries[i].pins = 0;
+		cache->entries[i].data = NULL;
+	}
+}
+
+static AssetCacheEntry* findEntry(AssetCache* cache, uint8_t id) {
+	for (uint8_t i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+		if (cache->entries[i].id == id) return &cache->entries[i];
+	}
+	return NULL;
+}
+
+// gives up on the idle decode and the room it was holding
+static void cancelDecode(AssetCache* cache) {
+	makiHuffmanDecodeCancel(&cache->decoder);
+	cache->used -= cache->assets[cache->decoding].decodedBytes;
+	cache->decoding = ASSET_CACHE_NONE;
+}
+
+static void evict(AssetCache* cache, AssetCacheEntry* entry) {
+	free(entry->data);
+	cache->used -= cache->assets[entry->id].decodedBytes;
+	entry->id = ASSET_CACHE_NONE;
+	entry->data = NULL;
+}
+
+// evicts least recently used unpinned entries until bytes fit and, if
+// needed, there's a free entry. an idle decode goes last. false if pinned
+// assets are in the way
+static bool makeRoom(AssetCache* cache, uint32_t bytes, bool needsEntry) {
+	while (true) {
+		AssetCacheEntry* oldest = NULL;
+		bool hasFree = false;
+
+		for (uint8_t i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+			AssetCacheEntry* entry = &cache->entries[i];
+			if (entry->id == ASSET_CACHE_NONE) {
+				hasFree = true;
+				continue;
+			}
+			if (entry->pins > 0) continue;
+			if (oldest == NULL || entry->lastUsed < oldest->lastUsed) {
+				oldest = entry;
+			}
+		}
+
+		bool fits = cache->used + bytes <= cache->budget;
+		if (fits && (hasFree || !needsEntry)) return true;
+
+		if (oldest != NULL) {
+			evict(cache, oldest);
+		} else if (cache->decoding != ASSET_CACHE_NONE) {
+			cancelDecode(cache);
+		} else {
+			return false;
+		}
+	}
+}
+
+// what makeRoom can't free: pinned assets and borrowed scratch
+static uint32_t lockedBytes(AssetCache* cache) {
+	uint32_t bytes = cache->used;
+	for (uint8_t i = 0; i < ASSET_CACHE_MAX_ENTRIES; i++) {
+		AssetCacheEntry* entry = &cache->entries[i];
+		if (entry->id != ASSET_CACHE_NONE && entry->pins == 0) {
+			bytes -= cache->assets[entry->id].decodedBytes;
+		}
+	}
+	return bytes;
+}
+
+// moves a finished idle decode into an entry, NULL if it failed
+static AssetCacheEntry* finishDecode(AssetCache* cache) {
+	uint8_t id = cache->decoding;
+	uint8_t* data = cache->decoder.output;
+	uint32_t bytes = cache->assets[id].decodedBytes;
+
+	// its room is already counted, this only needs an entry
+	cache->decoding = ASSET_CACHE_NONE;
+	cache->used -= bytes;
+	if (data == NULL) return NULL;
+	if (!makeRoom(cache, bytes, true)) {
+		free(data);
+		return NULL;
+	}
+
+	AssetCacheEntry* entry = findEntry(cache, ASSET_CACHE_NONE);
+	entry->id = id;
+	entry->pins = 0;
+	entry->data = data;
+	entry->lastUsed = ++cache->clock;
+	cache->used += bytes;
+	return entry;
+}
+
+uint8_t* assetCacheGet(AssetCache* cache, uint8_t id) {
+	if (id >= cache->assetCount) return NULL;
+
+	AssetCacheEntry* entry = findEntry(cache, id);
+
+	// part way through in idle time, the rest can't wait
+	if (entry == NULL && cache->decoding == id) {
+		while (!makiHuffmanDecodeStep(&cache->decoder, UINT32_MAX)) {
+		}
+		entry = finishDecode(cache);
+		if (entry == NULL) return NULL;
+	}
+
+	if (entry == NULL) {
+		const Asset* asset = &cache->assets[id];
+		if (!makeRoom(cache, asset->decodedBytes, true)) return NULL;
+
+		uint32_t size = asset->size;
+		uint8_t* data = makiHuffmanDecode(asset->data, &size);
+		if (data == NULL) return NULL;
+
+		entry = findEntry(cache, ASSET_CACHE_NONE);
+		entry->id = id;
+		entry->pins = 0;
+		entry->data = data;
+		cache->used += asset->decodedBytes;
+	}
+
+	if (cache->prefetch == id) cache->prefetch = ASSET_CACHE_NONE;
+
+	entry->lastUsed = ++cache->clock;
+	return entry->data;
+}
+
+void* assetCacheBorrow(AssetCache* cache, uint32_t bytes) {
+	if (!makeRoom(cache, bytes, false)) return NULL;
+
+	void* data = malloc(bytes);
+	if (data != NULL) cache->used += bytes;
+	return data;
+}
+
+void assetCacheReturn(AssetCache* cache, void* data, uint32_t bytes) {
+	if (data == NULL) return;
+	free(data);
+	cache->used -= bytes;
+}
+
+bool assetCacheContains(AssetCache* cache, uint8_t id) {
+	return findEntry(cache, id) != NULL;
+}
+
+void assetCachePin(AssetCache* cache, uint8_t id) {
+	AssetCacheEntry* entry = findEntry(cache, id);
+	if (entry != NULL) entry->pins++;
+}
+
+void assetCacheUnpin(AssetCache* cache, uint8_t id) {
+	AssetCacheEntry* entry = findEntry(cache, id);
+	if (entry != NULL && entry->pins > 0) entry->pins--;
+}
+
+void assetCachePrefetch(AssetCache* cache, uint8_t id) {
+	cache->prefetch = id < cache->assetCount ? id : ASSET_CACHE_NONE;
+}
+
+bool assetCacheIdle(AssetCache* cache) {
+	if (cache->decoding != ASSET_CACHE_NONE) {
+		if (makiHuffmanDecodeStep(&cache->decoder, ASSET_CACHE_IDLE_BYTES)) {
+			finishDecode(cache);
+		}
+		return true;
+	}
+
+	uint8_t id = cache->prefetch;
+	if (id == ASSET_CACHE_NONE) return false;
+	cache->prefetch = ASSET_CACHE_NONE;
+
+	if (findEntry(cache, id) != NULL) return false;
+
+	// checked before evicting or decoding anything, it often won't fit
+	// next to what the current screen has pinned
+	const Asset* asset = &cache->assets[id];
+	if (lockedBytes(cache) + asset->decodedBytes > cache->budget) {
+		return false;
+	}
+	if (!makeRoom(cache, asset->decodedBytes, true)) return false;
+	if (!makiHuffmanDecodeBegin(&cache->decoder, asset->data, asset->size)) {
+		return false;
+	}
+
+	// holds its room from the start, so nothing else takes it
+	cache->decoding = id;
+	cache->used += asset->decodedBytes;
+	return true;
+}
@@ -0,0 +1,83 @@
+#ifndef MAKI_ASSET_CACHE_H
+#define MAKI_ASSET_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "maki_huffman_decode.h"
+
+// decoded huffman assets kept in ram under a byte budget. the least
+// recently used unpinned asset goes first when something new needs room,
+// so going back to a recent screen doesn't decode again as long as its
+// assets fit next to the current screen's
+//
+// a screen pins its assets while it's shown. a prefetch decodes one asset
+// in idle time, a slice per assetCacheIdle, so the likely next screen is
+// ready when it's switched to. it's skipped before decoding anything when
+// it won't fit next to what's pinned, and it gives its room back to
+// anything else that needs it
+//
+// the maki image in assets.h is 115,200 of the 122,880 byte budget, so it
+// doesn't fit next to the game of life board and its prefetch from that
+// screen is skipped
+
+#define ASSET_CACHE_MAX_ENTRIES 8
+#define ASSET_CACHE_NONE 0xff
+
+// decoded per assetCacheIdle, a few ms on the rp2040
+#define ASSET_CACHE_IDLE_BYTES 4096
+
+typedef struct {
+	const uint8_t* data;  // makiHuffmanDecode input
+	uint32_t size;
+	uint32_t decodedBytes;
+} Asset;
+
+typedef struct {
+	uint8_t id;  // ASSET_CACHE_NONE when free
+	uint8_t pins;
+	uint8_t* data;
+	uint32_t lastUsed;
+} AssetCacheEntry;
+
+typedef struct {
+	const Asset* assets;
+	uint8_t assetCount;
+
+	AssetCacheEntry entries[ASSET_CACHE_MAX_ENTRIES];
+
+	uint32_t budget;
+	uint32_t used;
+	uint32_t clock;
+
+	volatile uint8_t prefetch;
+	// the prefetch being decoded, its room is already in used
+	uint8_t decoding;
+	MakiHuffmanDecoder decoder;
+} AssetCache;
+
+void assetCacheInit(AssetCache* cache, const Asset* assets,
+                    uint8_t assetCount, uint32_t budget);
+
+// decodes if it isn't cached. NULL if it couldn't be made room for or
+// allocated. only valid until something else is fetched, unless pinned
+uint8_t* assetCacheGet(AssetCache* cache, uint8_t id);
+bool assetCacheContains(AssetCache* cache, uint8_t id);
+
+// scratch memory under the same budget, evicting unpinned assets to make
+// room. NULL if it won't fit. give it back with the same size
+void* assetCacheBorrow(AssetCache* cache, uint32_t bytes);
+void assetCacheReturn(AssetCache* cache, void* data, uint32_t bytes);
+
+// pins count, pinned assets are never evicted
+void assetCachePin(AssetCache* cache, uint8_t id);
+void assetCacheUnpin(AssetCache* cache, uint8_t id);
+
+// replaces any earlier prefetch that hasn't run yet
+void assetCachePrefetch(AssetCache* cache, uint8_t id);
+
+// decodes a slice of the prefetch if there is one, call when there's time
+// to spare. true if it did anything, so there might be more
+bool assetCacheIdle(AssetCache* cache);
+
+#endif
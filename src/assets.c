@@ -0,0 +1,9 @@
+#include "assets.h"
+
+#include "images/maki_image.h"
+
+const Asset assets[ASSET_COUNT] = {
+    [ASSET_MAKI_IMAGE] = {maki_image, sizeof(maki_image), 240 * 240 * 2},
+};
+
+AssetCache assetCache;
@@ -0,0 +1,23 @@
+#ifndef MAKI_ASSETS_H
+#define MAKI_ASSETS_H
+
+#include "asset_cache.h"
+
+// huffman encoded images that get decoded into ram, see assets/make-image.ts.
+// images used straight from flash don't need to be here
+
+enum {
+	ASSET_MAKI_IMAGE = 0,
+	ASSET_COUNT,
+};
+
+// frame buffer and everything else needs the rest of the 264k. decoding
+// briefly needs more while the huffman rounds unpack
+#ifndef ASSETS_BUDGET
+#define ASSETS_BUDGET (120 * 1024)
+#endif
+
+extern const Asset assets[ASSET_COUNT];
+extern AssetCache assetCache;
+
+#endif
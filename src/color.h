@@ -2,35 +2,21 @@
 #define MAKI_COLOR_H
 
 #include <stdint.h>
-#include <math.h>
+
+// channels are Q8, 0 to 255 for 0.0 to 1.0. all integer since the rp2040
+// does floats in software
 
 typedef struct {
-    float r;
-    float g;
-    float b;
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
     uint16_t raw;
 } Color;
 
-void updateRaw(Color* color) {
-    uint8_t r = color->r * 0xff;
-    uint8_t g = color->g * 0xff;
-    uint8_t b = color->b * 0xff;
-
-    // r5 g6 b5
-    color->raw = (
-        ((r & 0b11111000) << 8) + 
-        ((g & 0b11111100) << 3) +
-        ((b & 0b11111000) >> 3
-    ));
-    
-    // swaps first 8 bits with last
-    color->raw = ((color->raw << 8) & 0xff00) | (color->raw >> 8);
-}
-
-uint16_t getRaw(uint8_t r, uint8_t g, uint8_t b) {
+static inline uint16_t getRaw(uint8_t r, uint8_t g, uint8_t b) {
     // r5 g6 b5
     uint16_t raw = (
-        ((r & 0b11111000) << 8) + 
+        ((r & 0b11111000) << 8) +
         ((g & 0b11111100) << 3) +
         ((b & 0b11111000) >> 3)
     );
@@ -41,27 +27,23 @@ uint16_t getRaw(uint8_t r, uint8_t g, uint8_t b) {
     return raw;
 }
 
-Color hexColor(uint8_t r, uint8_t g, uint8_t b) {
-    Color color;
-	color.r = (float)r / 0xff;
-	color.g = (float)g / 0xff;
-	color.b = (float)b / 0xff;
-    updateRaw(&color);
-    return color;
+static inline void updateRaw(Color* color) {
+    color->raw = getRaw(color->r, color->g, color->b);
 }
 
-float lerp(float a, float b, float f)
-{
-    return a * (1.0 - f) + (b * f);
-}
-
-Color lerpColor(Color a, Color b, float t) {
+static inline Color hexColor(uint8_t r, uint8_t g, uint8_t b) {
     Color color;
-    color.r = lerp(a.r, b.r, t);
-    color.g = lerp(a.g, b.g, t);
-    color.b = lerp(a.b, b.b, t);
+    color.r = r;
+    color.g = g;
+    color.b = b;
     updateRaw(&color);
     return color;
 }
 
-#endif
\ No newline at end of file
+// t is Q8 like the channels, 255 is all of b. the exact floor of x / 255
+static inline uint8_t lerp(uint8_t a, uint8_t b, uint8_t t) {
+    uint32_t x = a * (255 - t) + b * t;
+    return (x + 1 + (x >> 8)) >> 8;
+}
+
+#endif
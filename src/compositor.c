@@ -0,0 +1,194 @@
+#include "compositor.h"
+
+#include <string.h>
+
+#include "rgb565.h"
+
+static CompositorRect layerRect(Layer* layer) {
+	CompositorRect rect = {layer->x, layer->y, layer->x + layer->width,
+	                       layer->y + layer->height};
+	if (!layer->visible) rect.x1 = rect.x0;
+	return rect;
+}
+
+static bool rectEmpty(CompositorRect rect) {
+	return rect.x0 >= rect.x1 || rect.y0 >= rect.y1;
+}
+
+void compositorInit(Compositor* compositor, const uint8_t* background,
+                    uint16_t backgroundColor) {
+	compositor->background = background;
+	compositor->backgroundColor = backgroundColor;
+	compositor->layerCount = 0;
+	compositorMarkAllDirty(compositor);
+}
+
+bool compositorAddLayer(Compositor* compositor, Layer* layer) {
+	if (compositor->layerCount >= COMPOSITOR_MAX_LAYERS) return false;
+	compositor->layers[compositor->layerCount++] = layer;
+	layer->dirty = true;
+	return true;
+}
+
+void compositorMarkDirty(Compositor* compositor, CompositorRect rect) {
+	if (rect.x0 < 0) rect.x0 = 0;
+	if (rect.y0 < 0) rect.y0 = 0;
+	if (rect.x1 > COMPOSITOR_WIDTH) rect.x1 = COMPOSITOR_WIDTH;
+	if (rect.y1 > COMPOSITOR_HEIGHT) rect.y1 = COMPOSITOR_HEIGHT;
+	if (rectEmpty(rect)) return;
+
+	for (int16_t y = rect.y0; y < rect.y1; y++) {
+		compositor->dirtyRows[y / 32] |= 1UL << (y % 32);
+	}
+
+	if (rect.x0 < compositor->dirtyX0) compositor->dirtyX0 = rect.x0;
+	if (rect.x1 > compositor->dirtyX1) compositor->dirtyX1 = rect.x1;
+}
+
+void compositorMarkAllDirty(Compositor* compositor) {
+	memset(compositor->dirtyRows, 0xff, sizeof(compositor->dirtyRows));
+	compositor->dirtyX0 = 0;
+	compositor->dirtyX1 = COMPOSITOR_WIDTH;
+}
+
+void layerInit(Layer* layer, int16_t x, int16_t y, uint16_t width,
+               uint16_t height, const uint16_t* pixels, const uint8_t* alpha,
+               AlphaBits alphaBits) {
+	layer->x = x;
+	layer->y = y;
+	layer->width = width;
+	layer->height = height;
+	layer->pixels = pixels;
+	layer->alpha = alpha;
+	layer->alphaBits = alpha == NULL ? ALPHA_NONE : alphaBits;
+	layer->visible = true;
+	layer->dirty = true;
+	layer->drawn = (CompositorRect){0, 0, 0, 0};
+}
+
+void layerMove(Layer* layer, int16_t x, int16_t y) {
+	if (layer->x == x && layer->y == y) return;
+	layer->x = x;
+	layer->y = y;
+	layer->dirty = true;
+}
+
+void layerSetVisible(Layer* layer, bool visible) {
+	if (layer->visible == visible) return;
+	layer->visible = visible;
+	layer->dirty = true;
+}
+
+void layerMarkDirty(Layer* layer) { layer->dirty = true; }
+
+static void drawBackgroundRow(Compositor* compositor, uint16_t* row,
+                              int16_t y, int16_t x0, int16_t x1) {
+	if (compositor->background == NULL) {
+		for (int16_t x = x0; x < x1; x++) {
+			row[x] = compositor->backgroundColor;
+		}
+		return;
+	}
+
+	// big endian pixels, so a swap is the whole conversion
+	const uint8_t* image =
+	    &compositor->background[(y * COMPOSITOR_WIDTH + x0) * 2];
+	rgb565Swap(&row[x0], (const uint16_t*)image, x1 - x0);
+}
+
+static void drawLayerRow(Layer* layer, uint16_t* row, int16_t y, int16_t x0,
+                         int16_t x1) {
+	if (x0 < layer->x) x0 = layer->x;
+	if (x1 > layer->x + layer->width) x1 = layer->x + layer->width;
+	if (x0 >= x1) return;
+
+	uint16_t layerY = y - layer->y;
+	const uint16_t* pixels = &layer->pixels[layerY * layer->width];
+
+	if (layer->alphaBits == ALPHA_NONE) {
+		memcpy(&row[x0], &pixels[x0 - layer->x], (x1 - x0) * 2);
+		return;
+	}
+
+	uint16_t alphaStride = (layer->width * layer->alphaBits + 7) / 8;
+	const uint8_t* alpha = &layer->alpha[layerY * alphaStride];
+
+	for (int16_t x = x0; x < x1; x++) {
+		uint16_t layerX = x - layer->x;
+
+		if (layer->alphaBits == ALPHA_1BIT) {
+			if (alpha[layerX / 8] & (0x80 >> (layerX % 8))) {
+				row[x] = pixels[layerX];
+			}
+		} else {
+			uint8_t level = alpha[layerX / 2];
+			level = layerX % 2 ? level & 0x0f : level >> 4;
+
+			if (level == 0x0f) {
+				row[x] = pixels[layerX];
+			} else if (level != 0) {
+				// 0 to 15 onto 0 to 32, 15 never gets here
+				row[x] = rgb565BlendPixel(row[x], pixels[layerX],
+				                    (level << 1) + (level >> 3));
+			}
+		}
+	}
+}
+
+bool compositorRender(Compositor* compositor, uint16_t* buffer,
+                      CompositorRect* flushRect) {
+	// layers that changed dirty where they were and where they are now
+
+	for (uint8_t i = 0; i < compositor->layerCount; i++) {
+		Layer* layer = compositor->layers[i];
+		if (!layer->dirty) continue;
+
+		CompositorRect rect = layerRect(layer);
+		compositorMarkDirty(compositor, layer->drawn);
+		compositorMarkDirty(compositor, rect);
+
+		layer->drawn = rect;
+		layer->dirty = false;
+	}
+
+	int16_t x0 = compositor->dirtyX0;
+	int16_t x1 = compositor->dirtyX1;
+	if (x0 >= x1) return false;
+
+	int16_t y0 = COMPOSITOR_HEIGHT;
+	int16_t y1 = 0;
+
+	for (int16_t y = 0; y < COMPOSITOR_HEIGHT; y++) {
+		uint32_t word = compositor->dirtyRows[y / 32];
+
+		// skip clean words at once
+		if (word == 0) {
+			y += 31 - y % 32;
+			continue;
+		}
+		if (!(word & (1UL << (y % 32)))) continue;
+
+		if (y < y0) y0 = y;
+		y1 = y + 1;
+
+		uint16_t* row = &buffer[y * COMPOSITOR_WIDTH];
+		drawBackgroundRow(compositor, row, y, x0, x1);
+
+		for (uint8_t i = 0; i < compositor->layerCount; i++) {
+			Layer* layer = compositor->layers[i];
+			if (!layer->visible) continue;
+			if (y < layer->y || y >= layer->y + layer->height) continue;
+			drawLayerRow(layer, row, y, x0, x1);
+		}
+	}
+
+	memset(compositor->dirtyRows, 0, sizeof(compositor->dirtyRows));
+	compositor->dirtyX0 = COMPOSITOR_WIDTH;
+	compositor->dirtyX1 = 0;
+
+	if (flushRect != NULL) {
+		*flushRect = (CompositorRect){x0, y0, x1, y1};
+	}
+
+	return true;
+}
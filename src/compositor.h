@@ -0,0 +1,73 @@
+#ifndef MAKI_COMPOSITOR_H
+#define MAKI_COMPOSITOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// draws sprite layers over a static background, only recomposing the rows
+// that something moved or changed in since the last render
+
+#define COMPOSITOR_WIDTH 240
+#define COMPOSITOR_HEIGHT 240
+#define COMPOSITOR_MAX_LAYERS 8
+
+typedef enum {
+	ALPHA_NONE = 0,  // opaque
+	ALPHA_1BIT = 1,  // msb first, rows padded to a byte
+	ALPHA_4BIT = 4,  // high nibble first, rows padded to a byte
+} AlphaBits;
+
+// end is exclusive, same as LCD_1IN28_DisplayWindows
+typedef struct {
+	int16_t x0;
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+} CompositorRect;
+
+typedef struct {
+	int16_t x;
+	int16_t y;
+	uint16_t width;
+	uint16_t height;
+	// same byte swapped rgb565 as the screen buffer
+	const uint16_t* pixels;
+	const uint8_t* alpha;
+	AlphaBits alphaBits;
+	bool visible;
+
+	// set by the layer functions, picked up on the next render
+	bool dirty;
+	CompositorRect drawn;
+} Layer;
+
+typedef struct {
+	// same layout as makiHuffmanDecode output, or NULL for a solid color
+	const uint8_t* background;
+	uint16_t backgroundColor;
+
+	Layer* layers[COMPOSITOR_MAX_LAYERS];
+	uint8_t layerCount;
+
+	uint32_t dirtyRows[(COMPOSITOR_HEIGHT + 31) / 32];
+	int16_t dirtyX0;
+	int16_t dirtyX1;
+} Compositor;
+
+void compositorInit(Compositor* compositor, const uint8_t* background,
+                    uint16_t backgroundColor);
+bool compositorAddLayer(Compositor* compositor, Layer* layer);
+void compositorMarkDirty(Compositor* compositor, CompositorRect rect);
+void compositorMarkAllDirty(Compositor* compositor);
+bool compositorRender(Compositor* compositor, uint16_t* buffer,
+                      CompositorRect* flushRect);
+
+void layerInit(Layer* layer, int16_t x, int16_t y, uint16_t width,
+               uint16_t height, const uint16_t* pixels, const uint8_t* alpha,
+               AlphaBits alphaBits);
+void layerMove(Layer* layer, int16_t x, int16_t y);
+void layerSetVisible(Layer* layer, bool visible);
+// call after changing the pixels or alpha in place
+void layerMarkDirty(Layer* layer);
+
+#endif
@@ -0,0 +1,174 @@
+#include "fade.h"
+
+#include <string.h>
+
+#include "DEV_Config.h"
+#include "LCD_1in28.h"
+#include "rgb565.h"
+
+// cie 1931 lightness onto the 12 bit backlight, so fades look even
+// instead of jumping at the dark end. index is perceptual brightness.
+// full is one past the pwm wrap, anything less never stays on a whole
+// period
+
+static const uint16_t fadeCurve[FADE_FULL + 1] = {
+	0, 2, 4, 5, 7, 9, 11, 12, 14, 16, 18, 19, 21, 23, 25, 27,
+	28, 30, 32, 34, 35, 37, 39, 41, 43, 45, 47, 49, 51, 54, 56, 58,
+	61, 63, 66, 69, 71, 74, 77, 80, 83, 86, 89, 93, 96, 99, 103, 106,
+	110, 114, 118, 122, 126, 130, 134, 138, 143, 147, 152, 156, 161, 166, 171, 176,
+	181, 186, 191, 197, 202, 208, 214, 219, 225, 231, 238, 244, 250, 257, 263, 270,
+	277, 284, 291, 298, 305, 313, 320, 328, 335, 343, 351, 359, 368, 376, 384, 393,
+	402, 411, 420, 429, 438, 447, 457, 467, 476, 486, 496, 507, 517, 527, 538, 549,
+	560, 571, 582, 593, 605, 616, 628, 640, 652, 664, 677, 689, 702, 715, 728, 741,
+	754, 768, 781, 795, 809, 823, 837, 852, 867, 881, 896, 911, 927, 942, 958, 973,
+	989, 1006, 1022, 1038, 1055, 1072, 1089, 1106, 1123, 1141, 1159, 1177, 1195, 1213, 1232, 1250,
+	1269, 1288, 1307, 1327, 1346, 1366, 1386, 1406, 1427, 1447, 1468, 1489, 1510, 1532, 1553, 1575,
+	1597, 1619, 1642, 1664, 1687, 1710, 1733, 1757, 1780, 1804, 1828, 1852, 1877, 1902, 1927, 1952,
+	1977, 2003, 2028, 2054, 2081, 2107, 2134, 2161, 2188, 2215, 2243, 2270, 2299, 2327, 2355, 2384,
+	2413, 2442, 2472, 2501, 2531, 2561, 2592, 2622, 2653, 2684, 2716, 2747, 2779, 2811, 2843, 2876,
+	2909, 2942, 2975, 3009, 3042, 3077, 3111, 3145, 3180, 3215, 3251, 3286, 3322, 3358, 3395, 3431,
+	3468, 3505, 3543, 3580, 3618, 3657, 3695, 3734, 3773, 3812, 3852, 3892, 3932, 3972, 4013, 4054,
+	DEV_PWM_MAX + 1,
+};
+
+static void setBacklight(uint16_t brightness) {
+	DEV_SET_PWM_Level(fadeCurve[brightness > FADE_FULL ? FADE_FULL
+	                                                   : brightness]);
+}
+
+void fadeInit(Fade* fade) {
+	fade->brightness = 0;
+	fade->from = 0;
+	fade->to = 0;
+	fade->start = 0;
+	fade->duration = 0;
+
+	for (int16_t y = 0; y < FADE_HEIGHT; y++) {
+		fade->rows[y] = FADE_FULL;
+	}
+	fade->rowsScaled = false;
+	fade->rowsVersion = 0;
+	fade->rowsChanged = false;
+
+	setBacklight(0);
+}
+
+void fadeTo(Fade* fade, uint16_t brightness, uint32_t duration,
+            uint32_t now) {
+	if (brightness > FADE_FULL) brightness = FADE_FULL;
+
+	fade->from = fade->brightness;
+	fade->to = brightness;
+	fade->start = now;
+	fade->duration = duration;
+
+	if (duration == 0) {
+		fade->brightness = brightness;
+		setBacklight(brightness);
+	}
+}
+
+bool fadeActive(Fade* fade) { return fade->brightness != fade->to; }
+
+bool fadeUpdate(Fade* fade, uint32_t now) {
+	if (fadeActive(fade)) {
+		uint32_t elapsed = now - fade->start;
+		if (elapsed >= fade->duration) {
+			fade->brightness = fade->to;
+		} else {
+			int32_t range = (int32_t)fade->to - fade->from;
+			fade->brightness =
+			    fade->from + range * (int32_t)elapsed / (int32_t)fade->duration;
+		}
+		setBacklight(fade->brightness);
+	}
+
+	bool changed = fade->rowsChanged;
+	fade->rowsChanged = false;
+	return changed;
+}
+
+void fadeSetRows(Fade* fade, int16_t y0, int16_t y1, uint16_t brightness) {
+	if (y0 < 0) y0 = 0;
+	if (y1 > FADE_HEIGHT) y1 = FADE_HEIGHT;
+	if (brightness > FADE_FULL) brightness = FADE_FULL;
+
+	// worked out on the side so core1 only ever waits on the copy
+	uint16_t rows[FADE_HEIGHT];
+	memcpy(rows, fade->rows, sizeof(rows));
+
+	bool changed = false;
+	for (int16_t y = y0; y < y1; y++) {
+		if (rows[y] == brightness) continue;
+		rows[y] = brightness;
+		changed = true;
+	}
+	if (!changed) return;
+
+	bool scaled = false;
+	for (int16_t y = 0; y < FADE_HEIGHT; y++) {
+		if (rows[y] != FADE_FULL) {
+			scaled = true;
+			break;
+		}
+	}
+
+	fade->rowsVersion++;
+	__sync_synchronize();
+	memcpy(fade->rows, rows, sizeof(rows));
+	fade->rowsScaled = scaled;
+	__sync_synchronize();
+	fade->rowsVersion++;
+
+	fade->rowsChanged = true;
+}
+
+// core1's copy, taken again if core0 wrote the rows meanwhile. a flush
+// that starts before a change sends the old rows whole, and the change
+// asks for the frame again
+static bool snapshotRows(Fade* fade, uint16_t* rows) {
+	uint32_t version;
+	bool scaled;
+
+	do {
+		version = fade->rowsVersion;
+		__sync_synchronize();
+		scaled = fade->rowsScaled;
+		if (scaled) memcpy(rows, fade->rows, FADE_HEIGHT * 2);
+		__sync_synchronize();
+	} while ((version & 1) != 0 || version != fade->rowsVersion);
+
+	return scaled;
+}
+
+void fadeDisplayWindows(Fade* fade, uint16_t x0, uint16_t y0, uint16_t x1,
+                        uint16_t y1, uint16_t* buffer) {
+	static uint16_t rows[FADE_HEIGHT];
+	if (!snapshotRows(fade, rows)) {
+		LCD_1IN28_DisplayWindows(x0, y0, x1, y1, buffer);
+		return;
+	}
+
+	// scaled rows go out through a copy so the buffer stays as rendered
+	static uint16_t row[FADE_WIDTH];
+	uint16_t width = x1 - x0;
+
+	LCD_1IN28_SetWindows(x0, y0, x1, y1);
+	DEV_Digital_Write(LCD_DC_PIN, 1);
+
+	for (uint16_t y = y0; y < y1; y++) {
+		uint16_t* pixels = &buffer[y * FADE_WIDTH + x0];
+
+		if (rows[y] != FADE_FULL) {
+			memcpy(row, pixels, width * 2);
+			rgb565Scale(row, width, rows[y]);
+			pixels = row;
+		}
+
+		DEV_SPI_Write_nByte(LCD_SPI_PORT, (uint8_t*)pixels, width * 2);
+	}
+}
+
+void fadeDisplay(Fade* fade, uint16_t* buffer) {
+	fadeDisplayWindows(fade, 0, 0, FADE_WIDTH, FADE_HEIGHT, buffer);
+}
@@ -0,0 +1,52 @@
+#ifndef MAKI_FADE_H
+#define MAKI_FADE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// brightness without re-rendering. the whole screen fades on the
+// backlight, mapped so equal steps look equal. rows can also be scaled
+// while they're sent, for wipes and vignettes, which leaves the buffer as
+// rendered so it can just be sent again
+//
+// brightness is perceptual, 0 to 256
+
+#define FADE_WIDTH 240
+#define FADE_HEIGHT 240
+#define FADE_FULL 256
+
+typedef struct {
+	uint16_t brightness;
+	uint16_t from;
+	uint16_t to;
+	uint32_t start;
+	uint32_t duration;
+
+	// scale per row while flushing, FADE_FULL sends as is. core1 copies
+	// them at the start of each flush, odd versions are mid write
+	uint16_t rows[FADE_HEIGHT];
+	bool rowsScaled;
+	volatile uint32_t rowsVersion;
+	bool rowsChanged;
+} Fade;
+
+// starts dark, call fadeTo to bring it up
+void fadeInit(Fade* fade);
+
+// duration 0 jumps straight there
+void fadeTo(Fade* fade, uint16_t brightness, uint32_t duration, uint32_t now);
+bool fadeActive(Fade* fade);
+
+// moves the backlight along. true when rows changed since the last
+// flush, so the buffer needs sending again
+bool fadeUpdate(Fade* fade, uint32_t now);
+
+void fadeSetRows(Fade* fade, int16_t y0, int16_t y1, uint16_t brightness);
+
+// same as LCD_1IN28_Display and LCD_1IN28_DisplayWindows, with the row
+// scales applied on the way out
+void fadeDisplay(Fade* fade, uint16_t* buffer);
+void fadeDisplayWindows(Fade* fade, uint16_t x0, uint16_t y0, uint16_t x1,
+                        uint16_t y1, uint16_t* buffer);
+
+#endif
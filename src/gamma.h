@@ -0,0 +1,34 @@
+#ifndef MAKI_GAMMA_H
+#define MAKI_GAMMA_H
+
+#include <stdint.h>
+
+// blending in linear light. mixing gamma encoded values straight makes
+// midtones too dark, so fades look muddy halfway through
+//
+// decode tables give linear light from 0 to 4095, encode tables take
+// linear >> 2 back to 5, 6 or 8 bits. all srgb, computed offline
+
+#define GAMMA_LINEAR_MAX 4095
+
+extern const uint16_t gammaDecode5[32];
+extern const uint16_t gammaDecode6[64];
+extern const uint16_t gammaDecode8[256];
+extern const uint8_t gammaEncode5[1024];
+extern const uint8_t gammaEncode6[1024];
+extern const uint8_t gammaEncode8[1024];
+
+// 0xrrggbb colors, t is 0 to 256
+uint32_t gammaLerp(uint32_t from, uint32_t to, uint16_t t);
+
+// byte swapped rgb565 like the screen buffer, alpha is 0 to 256
+uint16_t gammaBlend(uint16_t under, uint16_t over, uint16_t alpha);
+
+// color over a whole buffer, or towards black. for a fixed alpha every
+// channel only has 32 or 64 results, so they're tabled once per call and
+// each pixel is three lookups
+void gammaBlendColor(uint16_t* buffer, uint16_t color, uint32_t count,
+                     uint16_t alpha);
+void gammaScale(uint16_t* buffer, uint32_t count, uint16_t brightness);
+
+#endif
@@ -0,0 +1,223 @@
+#include "gesture.h"
+
+#include <stdlib.h>
+
+void gestureInit(GestureEngine* engine) {
+	engine->longPressMs = 500;
+	engine->swipeMs = 300;
+	engine->releaseMs = 100;
+	engine->moveDistance = 12;
+	engine->swipeDistance = 40;
+	engine->rimRadius = 80;
+
+	engine->state = GESTURE_STATE_IDLE;
+}
+
+bool gestureActive(GestureEngine* engine) {
+	return engine->state != GESTURE_STATE_IDLE;
+}
+
+// clockwise from the right, within a quarter of a degree
+static uint16_t angleOf(int32_t x, int32_t y) {
+	if (x == 0 && y == 0) return 0;
+
+	int32_t ax = abs(x);
+	int32_t ay = abs(y);
+	bool steep = ay > ax;
+
+	// first octant, tan in Q15
+	int32_t r = steep ? (ax << 15) / ay : (ay << 15) / ax;
+
+	// atan(r) is about r / 8 + 0.0435 r (1 - r) turns
+	int32_t angle = (r >> 2) + ((2847 * ((r * (32768 - r)) >> 15)) >> 15);
+
+	if (steep) angle = GESTURE_TURN / 4 - angle;
+	if (x < 0) angle = GESTURE_TURN / 2 - angle;
+	if (y < 0) angle = GESTURE_TURN - angle;
+	return angle;
+}
+
+static void emit(Gesture* gesture, GestureType type, int16_t x, int16_t y) {
+	gesture->type = type;
+	gesture->x = x;
+	gesture->y = y;
+	gesture->dx = 0;
+	gesture->dy = 0;
+	gesture->angle = 0;
+}
+
+static bool release(GestureEngine* engine, Gesture* gesture) {
+	GestureState state = engine->state;
+	engine->state = GESTURE_STATE_IDLE;
+
+	if (state == GESTURE_STATE_PRESSED) {
+		emit(gesture, GESTURE_TAP, engine->startX, engine->startY);
+		return true;
+	}
+
+	if (state != GESTURE_STATE_DRAGGING) return false;
+
+	int16_t dx = engine->lastX - engine->startX;
+	int16_t dy = engine->lastY - engine->startY;
+	bool quick =
+	    engine->lastTime - engine->startTime <= engine->swipeMs * 1000u;
+
+	if (quick && abs(dx) >= engine->swipeDistance && abs(dx) >= abs(dy)) {
+		emit(gesture, dx < 0 ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT,
+		     engine->lastX, engine->lastY);
+	} else if (quick && abs(dy) >= engine->swipeDistance) {
+		emit(gesture, dy < 0 ? GESTURE_SWIPE_UP : GESTURE_SWIPE_DOWN,
+		     engine->lastX, engine->lastY);
+	} else {
+		emit(gesture, GESTURE_DRAG_END, engine->lastX, engine->lastY);
+	}
+
+	return true;
+}
+
+// starting near the rim and moving around it rather than across
+static bool startsScroll(GestureEngine* engine, int16_t x, int16_t y) {
+	int32_t sx = engine->startX - GESTURE_CENTER_X;
+	int32_t sy = engine->startY - GESTURE_CENTER_Y;
+	if (sx * sx + sy * sy < engine->rimRadius * engine->rimRadius) {
+		return false;
+	}
+
+	int32_t mx = x - engine->startX;
+	int32_t my = y - engine->startY;
+	return abs(sx * my - sy * mx) > abs(sx * mx + sy * my);
+}
+
+bool gestureSample(GestureEngine* engine, uint32_t time, bool down, int16_t x,
+                   int16_t y, Gesture* gesture) {
+	if (!down) return release(engine, gesture);
+
+	if (engine->state == GESTURE_STATE_IDLE) {
+		engine->state = GESTURE_STATE_PRESSED;
+		engine->startX = engine->lastX = x;
+		engine->startY = engine->lastY = y;
+		engine->startTime = engine->lastTime = time;
+		return false;
+	}
+
+	engine->lastTime = time;
+
+	if (engine->state == GESTURE_STATE_PRESSED) {
+		int32_t mx = x - engine->startX;
+		int32_t my = y - engine->startY;
+		if (mx * mx + my * my < engine->moveDistance * engine->moveDistance) {
+			return gestureUpdate(engine, time, gesture);
+		}
+
+		if (startsScroll(engine, x, y)) {
+			engine->state = GESTURE_STATE_SCROLLING;
+			engine->lastAngle = angleOf(engine->startX - GESTURE_CENTER_X,
+			                            engine->startY - GESTURE_CENTER_Y);
+		} else {
+			engine->state = GESTURE_STATE_DRAGGING;
+		}
+	}
+
+	if (engine->state == GESTURE_STATE_DRAGGING) {
+		int16_t dx = x - engine->lastX;
+		int16_t dy = y - engine->lastY;
+		engine->lastX = x;
+		engine->lastY = y;
+		if (dx == 0 && dy == 0) return false;
+
+		emit(gesture, GESTURE_DRAG, x, y);
+		gesture->dx = dx;
+		gesture->dy = dy;
+		return true;
+	}
+
+	if (engine->state == GESTURE_STATE_SCROLLING) {
+		uint16_t angle = angleOf(x - GESTURE_CENTER_X, y - GESTURE_CENTER_Y);
+		// wraps to the short way round
+		int16_t delta = angle - engine->lastAngle;
+		engine->lastAngle = angle;
+		engine->lastX = x;
+		engine->lastY = y;
+		if (delta == 0) return false;
+
+		emit(gesture, GESTURE_SCROLL, x, y);
+		gesture->angle = delta;
+		return true;
+	}
+
+	// long pressed, nothing more until it's let go
+	return false;
+}
+
+bool gestureUpdate(GestureEngine* engine, uint32_t time, Gesture* gesture) {
+	if (engine->state == GESTURE_STATE_IDLE) return false;
+
+	if (time - engine->lastTime >= engine->releaseMs * 1000u) {
+		return release(engine, gesture);
+	}
+
+	if (engine->state == GESTURE_STATE_PRESSED &&
+	    time - engine->startTime >= engine->longPressMs * 1000u) {
+		engine->state = GESTURE_STATE_LONG_PRESSED;
+		emit(gesture, GESTURE_LONG_PRESS, engine->startX, engine->startY);
+		return true;
+	}
+
+	return false;
+}
+
+const char* gestureName(GestureType type) {
+	static const char* names[] = {
+	    "none",       "tap",      "long press", "swipe left",
+	    "swipe right", "swipe up", "swipe down", "drag",
+	    "drag end",   "scroll",
+	};
+	return names[type];
+}
+
+#ifdef GESTURE_HOST_REPLAY
+
+#include <stdio.h>
+
+static void print(uint32_t time, Gesture* gesture) {
+	printf("%u %s %d %d", time, gestureName(gesture->type), gesture->x,
+	       gesture->y);
+	if (gesture->type == GESTURE_DRAG) {
+		printf(" %d %d", gesture->dx, gesture->dy);
+	}
+	if (gesture->type == GESTURE_SCROLL) {
+		printf(" %d", gesture->angle);
+	}
+	printf("\n");
+}
+
+int main() {
+	GestureEngine engine;
+	gestureInit(&engine);
+
+	// frames in between samples, like the main loop at full rate
+	const uint32_t frame = 1000000 / 30;
+
+	Gesture gesture;
+	uint32_t time, last = 0;
+	int down, x, y;
+	while (scanf("%u %d %d %d", &time, &down, &x, &y) == 4) {
+		for (uint32_t t = last + frame; last != 0 && t < time; t += frame) {
+			if (gestureUpdate(&engine, t, &gesture)) print(t, &gesture);
+		}
+		last = time;
+
+		if (gestureSample(&engine, time, down, x, y, &gesture)) {
+			print(time, &gesture);
+		}
+	}
+
+	// the trace might end with a finger still down
+	for (uint32_t t = last + frame; gestureActive(&engine); t += frame) {
+		if (gestureUpdate(&engine, t, &gesture)) print(t, &gesture);
+	}
+
+	return 0;
+}
+
+#endif
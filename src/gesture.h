@@ -0,0 +1,91 @@
+#ifndef MAKI_GESTURE_H
+#define MAKI_GESTURE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// turns raw touch samples into taps, long presses, swipes, drags and
+// circular scrolls around the rim, instead of the touch controller's own
+// recognizer and its fixed long press delay
+//
+// feed every sample from the controller to gestureSample and call
+// gestureUpdate every frame, which catches long presses held perfectly
+// still and releases the controller never reported. times are us so
+// they wrap cleanly with time_us_32
+//
+// built with GESTURE_HOST_REPLAY, gesture.c replays a recorded trace from
+// stdin, one "time_us down x y" sample per line, as printed by main.c with
+// GESTURE_TRACE:
+//
+// gcc -DGESTURE_HOST_REPLAY -Isrc src/gesture.c -o gesture-replay
+// ./gesture-replay < trace.txt
+//
+// tests/gestures has a trace of each gesture with its expected output,
+// checked by tests/run.sh
+
+#define GESTURE_CENTER_X 120
+#define GESTURE_CENTER_Y 120
+
+// angles are 1/65536 of a turn, clockwise on screen
+#define GESTURE_TURN 65536
+
+typedef enum {
+	GESTURE_NONE,
+	GESTURE_TAP,
+	GESTURE_LONG_PRESS,
+	GESTURE_SWIPE_LEFT,
+	GESTURE_SWIPE_RIGHT,
+	GESTURE_SWIPE_UP,
+	GESTURE_SWIPE_DOWN,
+	GESTURE_DRAG,
+	GESTURE_DRAG_END,
+	GESTURE_SCROLL,
+} GestureType;
+
+typedef struct {
+	GestureType type;
+	int16_t x, y;
+	// drag, since the last one
+	int16_t dx, dy;
+	// scroll, since the last one
+	int16_t angle;
+} Gesture;
+
+typedef enum {
+	GESTURE_STATE_IDLE,
+	GESTURE_STATE_PRESSED,
+	GESTURE_STATE_LONG_PRESSED,
+	GESTURE_STATE_DRAGGING,
+	GESTURE_STATE_SCROLLING,
+} GestureState;
+
+typedef struct {
+	// set by gestureInit, change after
+	uint16_t longPressMs;  // held still this long
+	uint16_t swipeMs;  // a drag let go within this is a swipe
+	uint16_t releaseMs;  // no samples this long is a release
+	uint8_t moveDistance;  // pixels before it's not a tap
+	uint8_t swipeDistance;
+	uint8_t rimRadius;  // starting further out than this can scroll
+
+	GestureState state;
+	int16_t startX, startY;
+	int16_t lastX, lastY;
+	uint32_t startTime;
+	uint32_t lastTime;
+	uint16_t lastAngle;
+} GestureEngine;
+
+void gestureInit(GestureEngine* engine);
+
+// true when it filled in gesture
+bool gestureSample(GestureEngine* engine, uint32_t time, bool down, int16_t x,
+                   int16_t y, Gesture* gesture);
+bool gestureUpdate(GestureEngine* engine, uint32_t time, Gesture* gesture);
+
+// a finger is down
+bool gestureActive(GestureEngine* engine);
+
+const char* gestureName(GestureType type);
+
+#endif
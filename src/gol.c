@@ -0,0 +1,245 @@
+#include "gol.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "parallel.h"
+
+// the half of the last word past the edge
+#define LAST_WORD_MASK 0x0000ffff
+
+void golClear(GolBoard* board) {
+	memset(board->cells, 0, sizeof(board->cells));
+	board->current = 0;
+	board->generation = 0;
+}
+
+void golSet(GolBoard* board, uint16_t x, uint16_t y, bool alive) {
+	if (x >= GOL_WIDTH || y >= GOL_HEIGHT) return;
+
+	uint32_t* word = &board->cells[board->current][y][x / 32];
+	uint32_t bit = 1u << (x % 32);
+	*word = alive ? *word | bit : *word & ~bit;
+}
+
+bool golGet(GolBoard* board, uint16_t x, uint16_t y) {
+	if (x >= GOL_WIDTH || y >= GOL_HEIGHT) return false;
+	return board->cells[board->current][y][x / 32] >> (x % 32) & 1;
+}
+
+// each cell's left and right neighbours moved onto its own bit
+
+static inline uint32_t leftOf(const uint32_t* row, uint8_t w) {
+	return row[w] << 1 | (w > 0 ? row[w - 1] >> 31 : 0);
+}
+
+static inline uint32_t rightOf(const uint32_t* row, uint8_t w) {
+	return row[w] >> 1 | (w < GOL_WORDS - 1 ? row[w + 1] << 31 : 0);
+}
+
+// a cell plus its left and right, 0 to 3 as two bit planes
+typedef struct {
+	uint32_t low[GOL_WORDS];
+	uint32_t high[GOL_WORDS];
+} Triples;
+
+static void countTriples(const uint32_t* row, Triples* triples) {
+	if (row == NULL) {
+		memset(triples, 0, sizeof(*triples));
+		return;
+	}
+
+	for (uint8_t w = 0; w < GOL_WORDS; w++) {
+		uint32_t left = leftOf(row, w);
+		uint32_t center = row[w];
+		uint32_t right = rightOf(row, w);
+
+		triples->low[w] = left ^ center ^ right;
+		triples->high[w] = (left & center) | (right & (left ^ center));
+	}
+}
+
+static void stepRow(const uint32_t* row, const Triples* above,
+                    const Triples* below, uint32_t* next) {
+	for (uint8_t w = 0; w < GOL_WORDS; w++) {
+		uint32_t center = row[w];
+		uint32_t left = leftOf(row, w);
+		uint32_t right = rightOf(row, w);
+
+		// above plus below, 0 to 6
+		uint32_t a0 = above->low[w], a1 = above->high[w];
+		uint32_t b0 = below->low[w], b1 = below->high[w];
+		uint32_t s0 = a0 ^ b0;
+		uint32_t carry = a0 & b0;
+		uint32_t half = a1 ^ b1;
+		uint32_t s1 = half ^ carry;
+		uint32_t s2 = (a1 & b1) | (half & carry);
+
+		// plus left and right, 8 wraps to 0 which dies the same way
+		uint32_t c0 = left ^ right;
+		uint32_t c1 = left & right;
+		uint32_t n0 = s0 ^ c0;
+		carry = s0 & c0;
+		half = s1 ^ c1;
+		uint32_t n1 = half ^ carry;
+		uint32_t n2 = s2 ^ ((s1 & c1) | (half & carry));
+
+		// 3, or 2 and alive
+		next[w] = n1 & ~n2 & (n0 | center);
+	}
+
+	next[GOL_WORDS - 1] &= LAST_WORD_MASK;
+}
+
+static void drawRow(const uint32_t* row, uint16_t* pixels) {
+	for (uint8_t w = 0; w < GOL_WORDS; w++) {
+		uint8_t count = w < GOL_WORDS - 1 ? 32 : GOL_WIDTH - w * 32;
+		uint32_t word = row[w];
+
+		if (word == 0) {
+			memset(pixels, 0, count * 2);
+		} else {
+			for (uint8_t i = 0; i < count; i++) {
+				pixels[i] = word >> i & 1 ? 0xffff : 0x0000;
+			}
+		}
+		pixels += count;
+	}
+}
+
+typedef struct {
+	GolBoard* board;
+	uint16_t* buffer;
+} StepJob;
+
+static void stepRows(void* context, uint16_t start, uint16_t end) {
+	StepJob* job = context;
+	uint32_t(*cells)[GOL_WORDS] = job->board->cells[job->board->current];
+	uint32_t(*next)[GOL_WORDS] = job->board->cells[job->board->current ^ 1];
+
+	// rolls down the chunk so each row's triples are only counted once
+	Triples counts[3];
+	Triples* above = &counts[0];
+	Triples* middle = &counts[1];
+	Triples* below = &counts[2];
+
+	countTriples(start > 0 ? cells[start - 1] : NULL, above);
+	countTriples(cells[start], middle);
+
+	for (uint16_t y = start; y < end; y++) {
+		countTriples(y + 1 < GOL_HEIGHT ? cells[y + 1] : NULL, below);
+
+		if (job->buffer != NULL) {
+			drawRow(cells[y], &job->buffer[y * GOL_WIDTH]);
+		}
+		stepRow(cells[y], above, below, next[y]);
+
+		Triples* spare = above;
+		above = middle;
+		middle = below;
+		below = spare;
+	}
+}
+
+void golStep(GolBoard* board, uint16_t* buffer) {
+	StepJob job = {board, buffer};
+	parallelFor(GOL_HEIGHT, stepRows, &job);
+
+	board->current ^= 1;
+	board->generation++;
+}
+
+#ifdef GOL_HOST_BENCHMARK
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// the old per cell rules, to check against and compare with
+static bool plain[2][GOL_HEIGHT][GOL_WIDTH];
+
+static void plainStep(bool cells[GOL_HEIGHT][GOL_WIDTH],
+                      bool next[GOL_HEIGHT][GOL_WIDTH]) {
+	for (int y = 0; y < GOL_HEIGHT; y++) {
+		for (int x = 0; x < GOL_WIDTH; x++) {
+			int neighbours = 0;
+			for (int dy = -1; dy < 2; dy++) {
+				for (int dx = -1; dx < 2; dx++) {
+					if ((dy != 0 || dx != 0) && x + dx > -1 &&
+					    x + dx < GOL_WIDTH && y + dy > -1 &&
+					    y + dy < GOL_HEIGHT && cells[y + dy][x + dx]) {
+						neighbours++;
+					}
+				}
+			}
+			next[y][x] = neighbours == 3 || (neighbours == 2 && cells[y][x]);
+		}
+	}
+}
+
+static double seconds(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+static GolBoard board;
+
+static void seed(void) {
+	golClear(&board);
+	srand(1);
+	for (uint16_t y = 0; y < GOL_HEIGHT; y++) {
+		for (uint16_t x = 0; x < GOL_WIDTH; x++) {
+			bool alive = rand() % 3 == 0;
+			golSet(&board, x, y, alive);
+			plain[0][y][x] = alive;
+		}
+	}
+}
+
+static double packedRate(uint32_t generations) {
+	seed();
+	double start = seconds();
+	for (uint32_t i = 0; i < generations; i++) golStep(&board, NULL);
+	return generations / (seconds() - start);
+}
+
+int main() {
+	const uint32_t generations = 2000;
+
+	// matches the plain rules
+	seed();
+	for (uint32_t i = 0; i < 200; i++) {
+		golStep(&board, NULL);
+		plainStep(plain[i & 1], plain[(i + 1) & 1]);
+	}
+	for (uint16_t y = 0; y < GOL_HEIGHT; y++) {
+		for (uint16_t x = 0; x < GOL_WIDTH; x++) {
+			if (golGet(&board, x, y) != plain[0][y][x]) {
+				printf("mismatch at %u, %u\n", x, y);
+				return 1;
+			}
+		}
+	}
+
+	seed();
+	double start = seconds();
+	for (uint32_t i = 0; i < 100; i++) {
+		plainStep(plain[i & 1], plain[(i + 1) & 1]);
+	}
+	double plainPerSecond = 100 / (seconds() - start);
+
+	double single = packedRate(generations);
+	parallelInit();
+	double both = packedRate(generations);
+
+	printf("plain        %8.0f generations/s\n", plainPerSecond);
+	printf("packed       %8.0f generations/s, %.0fx\n", single,
+	       single / plainPerSecond);
+	printf("packed, 2    %8.0f generations/s, %.0f%% scaling\n", both,
+	       both / single * 50);
+
+	return 0;
+}
+
+#endif
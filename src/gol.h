@@ -0,0 +1,40 @@
+#ifndef MAKI_GOL_H
+#define MAKI_GOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// game of life at one bit per cell, 32 cells to a word. neighbours are
+// counted for a whole word at once with bit sliced adders, so a generation
+// is a few dozen word operations per 32 cells instead of eight bounds
+// checked loads per cell. cells past the edges are dead
+//
+// rows are 8 words with the last half unused, so two generations are 15k.
+// a step is split across both cores
+//
+// built with GOL_HOST_BENCHMARK, gol.c checks itself against the plain
+// per cell rules and prints generations per second:
+//
+// gcc -O2 -DPARALLEL_HOST -DGOL_HOST_BENCHMARK -Isrc src/gol.c
+//     src/parallel.c -lpthread
+
+#define GOL_WIDTH 240
+#define GOL_HEIGHT 240
+#define GOL_WORDS 8
+
+typedef struct {
+	// x is bit x % 32 of word x / 32
+	uint32_t cells[2][GOL_HEIGHT][GOL_WORDS];
+	uint8_t current;
+	uint32_t generation;
+} GolBoard;
+
+void golClear(GolBoard* board);
+void golSet(GolBoard* board, uint16_t x, uint16_t y, bool alive);
+bool golGet(GolBoard* board, uint16_t x, uint16_t y);
+
+// draws the current generation into buffer, white on black, unless it's
+// NULL, and works out the next one in the same pass
+void golStep(GolBoard* board, uint16_t* buffer);
+
+#endif
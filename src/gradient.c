@@ -0,0 +1,271 @@
+#include "gradient.h"
+
+#include "gamma.h"
+#include "parallel.h"
+
+#include <stdbool.h>
+
+static const uint8_t bayer4[4][4] = {
+	{0, 8, 2, 10},
+	{12, 4, 14, 6},
+	{3, 11, 1, 9},
+	{15, 7, 13, 5},
+};
+
+// from color in Q16 and the difference per channel, so a pixel is
+// from + difference * t with t in Q16
+
+typedef struct {
+	int32_t r, g, b;
+	int32_t dr, dg, db;
+} Ramp;
+
+static void rampInit(Ramp* ramp, uint32_t fromColor, uint32_t toColor) {
+	int32_t r = (fromColor >> 16) & 0xff, g = (fromColor >> 8) & 0xff,
+	        b = fromColor & 0xff;
+	ramp->r = r << 16;
+	ramp->g = g << 16;
+	ramp->b = b << 16;
+	ramp->dr = (int32_t)((toColor >> 16) & 0xff) - r;
+	ramp->dg = (int32_t)((toColor >> 8) & 0xff) - g;
+	ramp->db = (int32_t)(toColor & 0xff) - b;
+}
+
+// channels in Q16
+static inline uint16_t ditherPixel(int32_t r, int32_t g, int32_t b,
+                                   uint8_t threshold) {
+	// threshold spread over the bits rgb565 drops, 3 for red and blue
+	// and 2 for green
+	uint32_t r5 = (r + (threshold << 15)) >> 19;
+	uint32_t g6 = (g + (threshold << 14)) >> 18;
+	uint32_t b5 = (b + (threshold << 15)) >> 19;
+	if (r5 > 31) r5 = 31;
+	if (g6 > 63) g6 = 63;
+	if (b5 > 31) b5 = 31;
+
+	uint16_t color = (r5 << 11) | (g6 << 5) | b5;
+	return (color >> 8) | (color << 8);
+}
+
+static inline uint16_t rampPixel(const Ramp* ramp, int32_t t,
+                                 uint8_t threshold) {
+	if (t < 0) t = 0;
+	if (t > 65536) t = 65536;
+
+	return ditherPixel(ramp->r + ramp->dr * t, ramp->g + ramp->dg * t,
+	                   ramp->b + ramp->db * t, threshold);
+}
+
+static uint32_t isqrt(uint32_t n) {
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30;
+	while (bit > n) bit >>= 2;
+	while (bit != 0) {
+		if (n >= root + bit) {
+			n -= root + bit;
+			root = (root >> 1) + bit;
+		} else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return root;
+}
+
+// columns of row y to fill, clipped to the screen and optionally to the
+// round display. false if there are none
+static bool rowSpan(int16_t y, int16_t x, uint16_t width, bool circular,
+                    int16_t* x0, int16_t* x1) {
+	*x0 = x < 0 ? 0 : x;
+	*x1 = x + width > GRADIENT_WIDTH ? GRADIENT_WIDTH : x + width;
+
+	if (circular) {
+		// in half pixels, pixel centers within the radius
+		int32_t dy = y * 2 + 1 - GRADIENT_HEIGHT;
+		int32_t half = isqrt(GRADIENT_WIDTH * GRADIENT_WIDTH - dy * dy);
+		int16_t left = (GRADIENT_WIDTH - half) / 2;
+		int16_t right = (GRADIENT_WIDTH - 1 + half) / 2 + 1;
+		if (left > *x0) *x0 = left;
+		if (right < *x1) *x1 = right;
+	}
+
+	return *x0 < *x1;
+}
+
+static void fillLinear(uint16_t* buffer, int16_t x, int16_t y, uint16_t width,
+                       uint16_t height, bool circular, int16_t fromX,
+                       int16_t fromY, uint32_t fromColor, int16_t toX,
+                       int16_t toY, uint32_t toColor) {
+	Ramp ramp;
+	rampInit(&ramp, fromColor, toColor);
+
+	// t is the projection onto the from to line, over its length squared
+	int32_t dx = toX - fromX;
+	int32_t dy = toY - fromY;
+	int64_t lengthSquared = (int64_t)dx * dx + (int64_t)dy * dy;
+	if (lengthSquared == 0) lengthSquared = 1;
+
+	int32_t stepX = (int64_t)dx * 65536 / lengthSquared;
+
+	int16_t y0 = y < 0 ? 0 : y;
+	int16_t y1 = y + height > GRADIENT_HEIGHT ? GRADIENT_HEIGHT : y + height;
+
+	for (int16_t row = y0; row < y1; row++) {
+		int16_t x0, x1;
+		if (!rowSpan(row, x, width, circular, &x0, &x1)) continue;
+
+		int64_t projection =
+		    (int64_t)(x0 - fromX) * dx + (int64_t)(row - fromY) * dy;
+		int32_t t = projection * 65536 / lengthSquared;
+
+		const uint8_t* thresholds = bayer4[row & 3];
+		uint16_t* out = &buffer[row * GRADIENT_WIDTH];
+
+		for (int16_t column = x0; column < x1; column++) {
+			out[column] = rampPixel(&ramp, t, thresholds[column & 3]);
+			t += stepX;
+		}
+	}
+}
+
+static void fillRadial(uint16_t* buffer, int16_t x, int16_t y, uint16_t width,
+                       uint16_t height, bool circular, int16_t centerX,
+                       int16_t centerY, uint16_t radius, uint32_t innerColor,
+                       uint32_t outerColor) {
+	Ramp ramp;
+	rampInit(&ramp, innerColor, outerColor);
+
+	if (radius == 0) radius = 1;
+
+	// the squared distance steps along the row and the whole pixel
+	// distance follows it, which moves by one at most per step. the 1/16
+	// pixels come from where the square sits between whole^2 and
+	// (whole + 1)^2, one divide instead of up to 16 nudges
+	int32_t edge = radius * 16;
+	int32_t scale = (4096 << 8) / radius;
+
+	int16_t y0 = y < 0 ? 0 : y;
+	int16_t y1 = y + height > GRADIENT_HEIGHT ? GRADIENT_HEIGHT : y + height;
+
+	for (int16_t row = y0; row < y1; row++) {
+		int16_t x0, x1;
+		if (!rowSpan(row, x, width, circular, &x0, &x1)) continue;
+
+		int32_t dx = x0 - centerX;
+		int32_t dy = row - centerY;
+		uint32_t square = dx * dx + dy * dy;
+		uint32_t whole = isqrt(square);
+
+		const uint8_t* thresholds = bayer4[row & 3];
+		uint16_t* out = &buffer[row * GRADIENT_WIDTH];
+
+		for (int16_t column = x0; column < x1; column++) {
+			if ((whole + 1) * (whole + 1) <= square) {
+				whole++;
+			} else if (whole * whole > square) {
+				whole--;
+			}
+
+			int32_t distance =
+			    whole * 16 + ((square - whole * whole) << 4) / (whole * 2 + 1);
+
+			int32_t t = distance >= edge ? 65536 : (distance * scale) >> 8;
+			out[column] = rampPixel(&ramp, t, thresholds[column & 3]);
+
+			// (dx + 1)^2 - dx^2
+			square += dx * 2 + 1;
+			dx++;
+		}
+	}
+}
+
+void gradientLinear(uint16_t* buffer, int16_t x, int16_t y, uint16_t width,
+                    uint16_t height, int16_t fromX, int16_t fromY,
+                    uint32_t fromColor, int16_t toX, int16_t toY,
+                    uint32_t toColor) {
+	fillLinear(buffer, x, y, width, height, false, fromX, fromY, fromColor,
+	           toX, toY, toColor);
+}
+
+void gradientRadial(uint16_t* buffer, int16_t x, int16_t y, uint16_t width,
+                    uint16_t height, int16_t centerX, int16_t centerY,
+                    uint16_t radius, uint32_t innerColor,
+                    uint32_t outerColor) {
+	fillRadial(buffer, x, y, width, height, false, centerX, centerY, radius,
+	           innerColor, outerColor);
+}
+
+void gradientLinearCircular(uint16_t* buffer, int16_t fromX, int16_t fromY,
+                            uint32_t fromColor, int16_t toX, int16_t toY,
+                            uint32_t toColor) {
+	fillLinear(buffer, 0, 0, GRADIENT_WIDTH, GRADIENT_HEIGHT, true, fromX,
+	           fromY, fromColor, toX, toY, toColor);
+}
+
+void gradientRadialCircular(uint16_t* buffer, int16_t centerX,
+                            int16_t centerY, uint16_t radius,
+                            uint32_t innerColor, uint32_t outerColor) {
+	fillRadial(buffer, 0, 0, GRADIENT_WIDTH, GRADIENT_HEIGHT, true, centerX,
+	           centerY, radius, innerColor, outerColor);
+}
+
+// both maps are split by rows across the cores
+
+typedef struct {
+	uint16_t* buffer;
+	const uint8_t* values;
+	Ramp ramp;
+	const uint32_t* colors;
+} MapJob;
+
+static void mapRows(void* context, uint16_t start, uint16_t end) {
+	MapJob* job = context;
+	uint16_t* buffer = &job->buffer[start * GRADIENT_WIDTH];
+	const uint8_t* values = &job->values[start * GRADIENT_WIDTH];
+
+	for (uint16_t row = start; row < end; row++) {
+		const uint8_t* thresholds = bayer4[row & 3];
+		for (int16_t column = 0; column < GRADIENT_WIDTH; column++) {
+			// 255 * 257 is just under 1.0 in Q16
+			*buffer++ = rampPixel(&job->ramp, *values++ * 257,
+			                      thresholds[column & 3]);
+		}
+	}
+}
+
+void gradientMap(uint16_t* buffer, const uint8_t* values, uint32_t fromColor,
+                 uint32_t toColor) {
+	MapJob job = {buffer, values};
+	rampInit(&job.ramp, fromColor, toColor);
+
+	parallelFor(GRADIENT_HEIGHT, mapRows, &job);
+}
+
+static void mapLinearRows(void* context, uint16_t start, uint16_t end) {
+	MapJob* job = context;
+	uint16_t* buffer = &job->buffer[start * GRADIENT_WIDTH];
+	const uint8_t* values = &job->values[start * GRADIENT_WIDTH];
+
+	for (uint16_t row = start; row < end; row++) {
+		const uint8_t* thresholds = bayer4[row & 3];
+		for (int16_t column = 0; column < GRADIENT_WIDTH; column++) {
+			uint32_t color = job->colors[*values++];
+			*buffer++ = ditherPixel((color >> 16) << 16,
+			                        ((color >> 8) & 0xff) << 16,
+			                        (color & 0xff) << 16,
+			                        thresholds[column & 3]);
+		}
+	}
+}
+
+void gradientMapLinear(uint16_t* buffer, const uint8_t* values,
+                       uint32_t fromColor, uint32_t toColor) {
+	// only 256 possible colors, static since it's too big for the stack
+	static uint32_t colors[256];
+	for (uint16_t i = 0; i < 256; i++) {
+		colors[i] = gammaLerp(fromColor, toColor, (i * 257 + 128) >> 8);
+	}
+
+	MapJob job = {buffer, values, .colors = colors};
+	parallelFor(GRADIENT_HEIGHT, mapLinearRows, &job);
+}
@@ -0,0 +1,44 @@
+#ifndef MAKI_GRADIENT_H
+#define MAKI_GRADIENT_H
+
+#include <stdint.h>
+
+// integer gradient fills with 4x4 ordered dithering, so smooth ramps don't
+// band in rgb565. colors are 0xrrggbb, output is the byte swapped rgb565
+// of the screen buffer. everything steps incrementally along each row.
+// the maps are split across both cores with parallelFor
+
+#define GRADIENT_WIDTH 240
+#define GRADIENT_HEIGHT 240
+
+// from one point to another, flat past either end
+void gradientLinear(uint16_t* buffer, int16_t x, int16_t y, uint16_t width,
+                    uint16_t height, int16_t fromX, int16_t fromY,
+                    uint32_t fromColor, int16_t toX, int16_t toY,
+                    uint32_t toColor);
+
+// from the center out to radius, flat past it
+void gradientRadial(uint16_t* buffer, int16_t x, int16_t y, uint16_t width,
+                    uint16_t height, int16_t centerX, int16_t centerY,
+                    uint16_t radius, uint32_t innerColor,
+                    uint32_t outerColor);
+
+// same, but only the pixels inside the round display are written, which
+// skips about a fifth of the frame
+void gradientLinearCircular(uint16_t* buffer, int16_t fromX, int16_t fromY,
+                            uint32_t fromColor, int16_t toX, int16_t toY,
+                            uint32_t toColor);
+void gradientRadialCircular(uint16_t* buffer, int16_t centerX,
+                            int16_t centerY, uint16_t radius,
+                            uint32_t innerColor, uint32_t outerColor);
+
+// maps a full frame of 8 bit values from one color to another
+void gradientMap(uint16_t* buffer, const uint8_t* values, uint32_t fromColor,
+                 uint32_t toColor);
+
+// same but mixed in linear light, see gamma.h. brighter and cleaner
+// through the midtones, for glows and fades
+void gradientMapLinear(uint16_t* buffer, const uint8_t* values,
+                       uint32_t fromColor, uint32_t toColor);
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef FONT24_MAKI_SDF
+#define FONT24_MAKI_SDF
+// generated by assets/make-sdf.ts from font24.c
+#include "../sdf.h"
+const uint8_t font24_maki_sdf_data[3200] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,17,17,17,17,17,17,15,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,35,47,49,49,49,49,49,49,47,35,15,0,0,0,0,0,0,0,0,0,0,0,0,15,35,60,77,80,80,80,80,80,80,77,60,35,15,0,0,0,0,0,0,0,0,0,0,6,35,60,78,105,112,112,112,112,112,112,105,78,60,35,15,0,0,0,0,0,0,0,0,0,15,47,77,105,113,143,144,144,144,144,143,113,105,78,60,35,6,0,0,0,0,0,0,0,0,17,49,80,112,142,144,144,144,144,144,144,143,113,105,77,47,15,0,0,0,0,0,0,0,0,15,47,77,105,112,112,112,112,112,112,113,144,143,112,80,49,17,0,0,0,0,0,0,0,0,15,36,61,79,82,105,112,112,112,112,113,144,144,112,80,49,17,0,0,0,0,0,0,0,6,35,60,78,105,112,113,143,144,144,144,144,151,144,112,80,49,17,0,0,0,0,0,0,0,15,47,77,105,113,143,144,144,144,144,144,144,151,144,112,80,49,17,0,0,0,0,0,0,0,17,49,80,112,143,150,143,113,112,112,112,113,144,144,112,80,49,35,15,0,0,0,0,0,0,17,49,80,112,144,144,113,105,82,82,105,113,144,144,112,81,77,60,35,6,0,0,0,0,0,17,49,80,112,143,144,113,112,112,112,113,143,151,144,113,112,105,77,47,15,0,0,0,0,0,15,47,77,105,113,143,144,144,144,144,144,144,151,151,144,143,112,80,49,17,0,0,0,0,0,6,35,60,78,105,113,143,144,144,144,143,114,143,144,144,143,112,80,49,17,0,0,0,0,0,0,15,35,60,78,105,112,112,112,112,112,106,112,112,112,112,105,77,47,15,0,0,0,0,0,0,0,15,35,60,77,80,80,80,80,80,78,80,80,80,80,77,60,35,6,0,0,0,0,0,0,0,0,15,35,47,49,49,49,49,49,47,49,49,49,49,47,35,15,0,0,0,0,0,0,0,0,0,0,6,15,17,17,17,17,17,16,17,17,17,17,15,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,17,17,15,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,35,47,49,49,47,35,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,35,60,77,80,80,77,60,35,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,47,77,105,112,112,105,77,47,15,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,18,49,80,112,143,143,112,80,49,17,0,0,0,0,0,0,0,0,0,0,0,0,15,35,47,49,50,80,112,143,143,112,80,49,17,0,0,0,0,0,0,0,0,0,0,0,6,35,60,77,80,80,81,105,112,112,105,77,47,15,0,0,0,0,0,0,0,0,0,0,0,15,47,77,105,112,112,112,112,112,112,105,77,47,15,0,0,0,0,0,0,0,0,0,0,0,17,49,80,112,143,144,144,144,144,143,112,80,49,17,0,0,0,0,0,0,0,0,0,0,0,17,49,80,112,143,144,144,144,151,144,112,80,49,17,0,0,0,0,0,0,0,0,0,0,0,15,47,77,105,112,112,112,113,144,144,112,80,49,17,0,0,0,0,0,0,0,0,0,0,0,6,35,60,77,80,80,81,112,144,144,112,80,49,17,0,0,0,0,0,0,0,0,0,0,0,0,15,35,47,49,50,80,112,144,144,112,80,49,17,0,0,0,0,0,0,0,0,0,0,0,0,6,15,18,19,49,80,112,144,144,112,80,49,18,17,15,6,0,0,0,0,0,0,0,0,15,35,47,49,49,50,80,112,144,144,112,80,50,49,49,47,35,15,0,0,0,0,0,0,6,35,60,77,80,80,80,81,112,144,144,112,81,80,80,80,77,60,35,6,0,0,0,0,0,15,47,77,105,112,112,112,112,113,144,144,113,112,112,112,112,105,77,47,15,0,0,0,0,0,17,49,80,112,143,144,144,144,144,151,151,144,144,144,144,143,112,80,49,17,0,0,0,0,0,17,49,80,112,143,144,144,144,144,144,144,144,144,144,144,143,112,80,49,17,0,0,0,0,0,15,47,77,105,112,112,112,112,112,112,112,112,112,112,112,112,105,77,47,15,0,0,0,0,0,6,35,60,77,80,80,80,80,80,80,80,80,80,80,80,80,77,60,35,6,0,0,0,0,0,0,15,35,47,49,49,49,49,49,49,49,49,49,49,49,49,47,35,15,0,0,0,0,0,0,0,0,6,15,17,17,17,17,17,17,17,17,17,17,17,17,15,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,17,17,17,17,15,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,35,47,49,49,49,49,47,35,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,35,60,77,80,80,80,80,77,60,35,6,0,0,0,0,0,0,0,0,0,0,0,0,0,15,47,77,105,112,112,112,112,105,77,47,15,0,0,0,0,0,0,0,0,0,0,0,0,0,17,49,80,112,143,144,144,143,112,80,49,18,17,17,17,15,6,0,0,0,0,0,0,0,0,17,49,80,112,143,144,151,144,112,80,50,49,49,49,49,47,35,15,0,0,0,0,0,0,0,15,47,77,105,112,113,144,144,112,81,80,80,80,80,80,77,60,35,6,0,0,0,0,0,0,6,35,60,77,81,112,144,144,112,105,112,112,112,112,112,105,77,47,15,0,0,0,0,0,0,0,15,35,49,80,112,144,144,112,112,143,144,144,144,143,112,80,49,17,0,0,0,0,0,0,0,0,17,49,80,112,144,144,112,112,144,151,144,144,143,112,80,49,17,0,0,0,0,0,0,0,0,17,49,80,112,144,144,112,113,144,143,113,112,112,105,77,47,15,0,0,0,0,0,0,0,0,17,49,80,112,144,144,114,143,144,113,105,80,80,77,60,35,6,0,0,0,0,0,0,0,0,17,49,80,112,144,151,144,150,143,112,80,60,49,47,35,15,0,0,0,0,0,0,0,0,0,17,49,80,112,144,175,174,144,114,106,78,60,35,18,15,6,0,0,0,0,0,0,0,0,15,35,49,80,112,144,151,144,150,143,113,105,78,60,49,47,35,15,0,0,0,0,0,0,6,35,60,77,81,112,144,144,114,143,150,143,113,105,80,80,77,60,35,6,0,0,0,0,0,15,47,77,105,112,113,144,144,112,113,143,150,143,113,112,112,105,77,47,15,0,0,0,0,0,17,49,80,112,143,144,151,144,112,105,113,144,151,144,144,143,112,80,49,17,0,0,0,0,0,17,49,80,112,143,144,144,143,112,82,112,143,144,144,144,143,112,80,49,17,0,0,0,0,0,15,47,77,105,112,112,112,112,105,79,105,112,112,112,112,112,105,77,47,15,0,0,0,0,0,6,35,60,77,80,80,80,80,77,61,77,80,80,80,80,80,77,60,35,6,0,0,0,0,0,0,15,35,47,49,49,49,49,47,36,47,49,49,49,49,49,47,35,15,0,0,0,0,0,0,0,0,6,15,17,17,17,17,15,7,15,17,17,17,17,17,15,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,17,17,17,17,16,17,17,17,16,17,17,17,17,15,6,0,0,0,0,0,0,0,15,35,47,49,49,49,49,47,49,49,49,47,49,49,49,49,47,35,15,0,0,0,0,0,6,35,60,77,80,80,80,80,78,80,80,80,78,80,80,80,80,77,60,35,15,0,0,0,0,15,47,77,105,112,112,112,112,106,112,112,112,106,112,112,112,112,105,78,60,35,6,0,0,0,17,49,80,112,143,144,144,143,114,143,144,143,114,143,144,144,143,113,105,77,47,15,0,0,0,17,49,80,112,143,144,151,151,144,144,144,150,144,150,144,144,150,143,112,80,49,17,0,0,0,15,47,77,105,112,113,144,151,143,113,113,144,151,143,113,113,144,144,112,80,49,17,0,0,0,6,35,60,77,81,112,144,144,113,105,112,144,144,113,105,112,144,144,112,80,49,17,0,0,0,0,15,35,49,80,112,144,144,112,82,112,144,144,112,82,112,144,144,112,80,49,17,0,0,0,0,0,17,49,80,112,144,144,112,82,112,144,144,112,82,112,144,144,112,80,49,17,0,0,0,0,15,35,49,80,112,144,144,112,82,112,144,144,112,82,112,144,144,112,80,49,35,15,0,0,6,35,60,77,81,112,144,144,112,82,112,144,144,112,82,112,144,144,112,81,77,60,35,6,0,15,47,77,105,112,113,144,144,113,112,112,144,144,113,112,112,144,144,113,112,105,77,47,15,0,17,49,80,112,143,144,151,151,144,143,114,144,151,144,143,114,144,151,144,143,112,80,49,17,0,17,49,80,112,143,144,144,144,144,143,114,143,144,144,143,114,143,144,144,143,112,80,49,17,0,15,47,77,105,112,112,112,112,112,112,106,112,112,112,112,106,112,112,112,112,105,77,47,15,0,6,35,60,77,80,80,80,80,80,80,78,80,80,80,80,78,80,80,80,80,77,60,35,6,0,0,15,35,47,49,49,49,49,49,49,47,49,49,49,49,47,49,49,49,49,47,35,15,0,0,0,0,6,15,17,17,17,17,17,17,16,17,17,17,17,16,17,17,17,17,15,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
+const SdfField font24_maki_sdf = {25, 32, 4, 4, 32, 17, font24_maki_sdf_data, "aikm"};
+#endif
@@ -1,4 +0,0 @@
-#ifndef HEXCORP_IMAGE
-#define HEXCORP_IMAGE
-const unsigned char hexcorp_image[7516] = {2,5,225,45,0,0,255,1,0,0,207,255,195,48,252,48,240,195,255,12,60,48,252,51,3,195,195,15,252,48,195,195,195,15,240,195,195,15,195,48,252,48,240,195,255,240,240,207,0,60,60,48,63,240,195,15,48,240,195,252,60,48,252,12,63,12,60,15,255,240,48,240,195,240,195,240,195,195,15,252,195,195,0,243,15,12,51,255,204,0,240,195,240,204,15,255,195,60,0,252,48,240,195,252,48,252,48,240,195,252,48,243,0,255,195,15,48,240,195,252,48,60,51,192,255,15,12,63,48,240,195,240,204,15,204,15,192,192,255,206,33,213,193,194,199,73,20,158,25,28,111,156,179,172,185,100,87,250,244,238,92,215,119,214,94,231,83,74,35,128,157,144,200,55,47,227,12,149,31,191,154,96,140,52,79,130,2,133,70,71,155,7,129,65,14,175,44,89,103,239,116,176,86,93,153,218,122,251,110,123,174,187,237,195,42,21,80,57,242,19,62,85,58,197,98,22,138,240,248,192,146,10,177,139,23,229,32,38,141,120,209,108,208,181,163,56,66,131,201,6,5,24,15,50,225,132,134,34,160,162,17,224,135,68,230,166,150,54,212,184,46,186,220,216,142,217,91,182,173,190,90,243,127,168,204,49,97,234,95,72,170,235,183,253,236,60,203,202,69,223,18,167,64,40,59,76,252,245,233,124,219,171,107,249,254,226,152,228,8,36,106,136,1,241,165,13,164,115,105,43,117,121,78,198,75,30,232,196,148,45,189,126,207,84,11,145,147,37,67,109,53,205,125,151,113,112,101,26,39,169,51,143,161,118,114,99,16,82,61,27,211,88,29,178,102,9,221,104,246,180,210,247,188,222,3,48,41,4,63,77,137,0,159,81,254,255,112,31,239,245,207,254,255,75,58,26,27,250,31,190,107,246,207,239,248,201,179,161,161,161,191,223,248,179,181,89,208,164,189,151,244,55,255,139,58,20,150,199,241,191,99,247,201,191,146,253,146,216,208,208,223,172,232,104,111,232,111,228,189,151,233,47,191,178,213,103,251,103,67,67,248,73,108,127,27,255,22,116,61,186,31,189,169,154,216,254,55,254,31,223,218,27,249,47,218,27,249,47,217,45,143,225,103,67,154,216,254,18,91,29,143,227,246,75,99,248,223,177,252,111,246,95,208,223,201,127,110,190,246,75,131,248,50,20,65,129,157,169,158,24,175,240,157,255,47,108,241,212,125,42,14,126,125,15,167,239,208,73,103,35,228,204,198,34,30,166,3,105,6,136,188,158,85,5,187,75,103,152,142,93,65,249,59,12,245,77,242,229,255,47,26,118,237,114,99,61,85,174,229,158,246,183,125,183,87,214,122,222,48,90,243,39,207,199,71,234,71,34,72,61,62,211,55,96,164,228,219,58,95,87,7,226,152,120,224,110,105,143,214,132,92,244,56,213,209,109,254,58,219,14,55,23,121,142,249,190,116,156,251,25,241,137,102,86,238,213,5,63,117,214,248,155,235,227,147,60,231,107,251,209,225,255,109,247,17,239,63,9,31,249,177,216,78,239,32,251,111,159,236,122,28,169,164,215,30,144,236,23,217,155,117,251,7,211,194,250,63,254,3,13,246,172,185,255,188,188,236,223,99,246,247,240,169,78,195,31,192,114,31,3,144,115,39,251,135,99,19,220,108,228,87,172,137,135,203,20,82,246,93,246,113,28,25,21,191,158,110,69,237,246,124,20,46,113,98,207,93,57,174,13,138,104,14,119,188,160,238,70,172,174,71,196,218,189,221,165,239,115,12,221,67,125,47,79,217,191,21,244,95,33,219,2,199,125,192,34,170,7,23,27,57,135,208,105,212,143,62,254,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,57,242,160,0,0,1,198,129,250,61,63,100,82,0,0,0,28,103,191,163,211,199,243,81,236,241,201,154,227,219,0,0,0,0,176,123,125,251,62,211,232,255,31,142,148,183,178,193,228,59,220,194,245,136,0,0,0,120,113,24,56,238,63,183,201,224,211,149,239,196,215,68,194,217,168,201,159,186,80,0,0,2,71,201,138,60,24,185,6,66,200,50,145,207,7,163,177,182,214,190,76,70,195,20,71,50,128,0,0,241,95,40,126,191,209,242,118,240,243,99,149,7,194,103,239,150,90,214,190,28,217,183,146,130,0,0,0,139,181,108,109,254,41,127,155,10,253,47,114,127,12,141,204,214,181,172,204,118,159,230,95,128,0,1,135,185,228,23,61,255,167,225,185,189,199,14,119,202,254,62,150,181,184,152,216,107,95,39,71,13,18,222,192,0,0,229,115,183,202,116,127,158,54,59,41,66,61,123,199,189,104,235,95,63,123,12,65,199,251,78,214,181,243,247,156,83,98,192,0,1,6,194,250,24,78,202,51,55,99,183,127,140,220,111,187,27,173,123,207,155,139,116,71,65,110,255,71,222,203,90,220,90,99,214,95,160,0,1,23,32,138,40,205,102,120,206,231,234,117,6,42,25,63,248,53,173,99,23,191,236,30,105,198,57,111,243,62,206,181,235,204,150,223,103,50,160,0,3,127,165,239,202,68,31,87,255,61,243,241,204,173,253,93,223,221,191,90,245,195,227,255,236,44,133,253,200,62,127,221,154,74,214,119,198,127,188,61,64,0,0,225,198,185,243,105,149,135,107,116,254,113,17,103,240,148,184,219,53,168,95,247,239,203,131,55,242,124,190,207,19,39,90,210,244,236,80,172,160,0,6,30,231,136,110,215,244,109,221,27,140,161,106,184,220,223,87,90,215,195,87,47,211,191,33,95,45,12,38,181,239,107,252,73,92,118,192,0,4,123,167,249,200,172,116,109,221,27,140,161,219,224,123,87,62,181,175,47,239,124,154,95,157,12,223,106,187,221,107,95,140,31,167,127,231,126,128,0,59,113,156,188,37,253,28,93,50,125,251,156,49,251,237,203,246,117,175,119,246,91,153,6,24,175,203,255,140,243,51,186,215,187,63,217,110,128,0,25,63,99,55,13,206,88,181,239,201,203,127,79,58,217,228,250,43,90,88,239,101,215,126,50,142,76,223,239,132,243,235,94,246,188,220,63,236,112,0,0,27,248,15,197,151,247,145,174,76,92,249,40,109,48,223,91,33,81,214,190,19,143,168,12,53,187,21,192,214,189,243,248,247,222,15,14,0,1,190,131,254,76,21,226,195,92,223,110,91,250,79,241,206,199,242,173,123,192,204,169,192,145,219,103,249,75,133,150,181,139,240,195,105,0,0,100,227,92,15,229,228,178,214,65,23,109,240,153,56,126,52,157,93,107,120,146,194,229,5,235,5,240,159,97,53,173,124,127,127,28,183,177,0,1,134,133,208,192,216,181,118,136,182,25,185,147,202,200,80,186,214,188,188,3,32,207,3,125,44,87,234,104,235,95,204,149,230,207,248,0,3,183,25,211,232,206,168,235,32,139,182,248,76,156,207,54,89,205,214,176,48,201,172,136,14,71,191,64,249,252,221,107,215,167,233,91,0,1,199,222,66,232,96,108,90,204,137,239,185,175,105,206,181,117,30,93,107,75,121,221,92,0,102,190,55,187,162,19,5,90,194,119,55,169,226,193,250,0,17,126,184,26,89,189,37,127,248,246,110,127,148,62,78,149,234,39,214,189,126,31,15,204,3,241,41,52,254,115,53,173,115,48,11,250,31,76,0,34,255,252,249,13,242,203,89,145,61,247,53,237,39,252,79,161,200,214,186,123,153,5,56,2,47,57,246,186,168,221,107,215,149,47,155,0,14,61,43,101,151,226,155,173,114,98,237,190,19,39,188,7,54,142,181,137,146,183,127,128,36,118,223,177,140,216,108,181,174,159,187,179,204,250,37,0,13,252,63,223,50,113,98,214,185,49,118,223,9,208,195,226,239,245,173,98,97,214,91,96,7,138,74,227,16,218,245,173,77,169,179,46,11,40,1,128,76,168,126,173,107,25,13,250,255,115,135,9,177,150,109,53,175,13,243,163,14,0,113,138,173,240,186,214,177,155,190,46,152,0,111,150,98,117,172,93,50,125,251,156,56,245,143,151,73,90,224,252,27,95,208,3,0,220,230,247,235,90,185,99,182,28,77,8,1,122,233,231,117,133,224,115,243,115,38,33,185,231,90,214,177,54,59,44,160,6,43,242,251,245,88,28,238,181,235,63,124,159,204,160,2,155,212,216,53,110,232,220,101,8,54,214,230,181,235,94,180,206,186,203,40,1,198,91,79,185,105,223,250,214,185,185,191,139,60,0,166,245,54,12,204,133,245,254,229,166,101,219,153,173,107,173,243,240,191,224,1,191,97,253,153,245,53,173,126,95,239,46,7,16,0,189,116,243,184,94,198,248,97,230,124,255,42,181,248,249,242,239,32,0,90,108,62,87,47,242,177,107,90,140,178,242,69,128,113,163,131,174,110,213,48,111,198,63,40,76,110,181,226,151,76,165,0,3,127,38,123,151,95,46,181,175,126,202,239,247,205,222,64,58,31,253,190,100,79,96,37,208,104,254,59,173,102,99,246,172,24,0,56,197,88,110,221,29,107,214,153,109,236,37,223,160,20,152,106,51,111,116,82,232,90,160,39,234,215,188,62,91,134,202,0,14,134,106,59,39,5,90,214,227,124,249,248,64,44,56,152,220,38,234,231,69,245,152,156,103,90,245,187,245,216,48,0,56,216,163,247,137,44,78,181,174,77,230,245,218,0,227,71,7,91,188,142,222,185,37,222,255,55,90,241,75,172,82,32,0,56,203,119,109,165,159,155,90,215,229,231,217,112,219,128,89,222,60,127,25,205,131,247,161,145,245,174,156,142,251,136,0,1,190,38,187,199,49,221,107,83,108,154,6,35,1,103,120,241,255,247,238,235,15,55,94,184,108,141,10,0,0,180,216,115,248,156,23,207,173,106,23,215,192,79,64,90,64,237,253,101,99,153,121,23,90,222,36,176,177,96,0,22,146,252,231,130,19,27,173,122,221,30,254,110,84,9,143,231,95,7,78,29,190,125,212,47,251,247,249,64,0,24,124,39,205,180,214,181,111,207,237,128,152,254,117,134,114,246,214,153,22,183,29,176,0,3,39,153,246,243,110,2,181,141,236,100,32,89,238,108,183,23,217,106,195,205,204,246,0,0,16,19,28,141,253,167,107,81,255,189,216,11,61,205,150,47,15,6,89,65,82,236,16,0,1,147,246,216,15,46,147,191,213,228,202,129,15,131,209,153,207,92,122,170,222,37,64,0,14,135,79,172,216,209,135,249,246,224,56,115,88,63,95,139,145,117,239,133,0,0,30,117,253,28,39,229,136,3,135,53,131,204,216,55,34,235,223,126,80,0,3,103,17,39,25,237,244,191,64,166,96,107,113,149,223,62,234,92,0,0,228,94,126,159,131,251,53,149,99,157,133,127,139,166,231,3,135,53,131,245,200,142,69,215,188,242,0,1,198,217,71,59,136,196,74,111,146,166,234,125,196,103,128,128,206,82,77,39,101,38,186,55,96,0,11,75,86,164,225,220,111,125,101,126,136,70,120,8,12,229,39,91,63,44,60,220,200,140,0,3,124,75,242,215,107,59,113,189,245,149,205,218,166,0,64,103,41,35,127,201,148,157,45,232,0,2,210,151,88,88,165,247,216,234,221,132,183,129,23,248,178,232,254,167,17,190,189,72,0,5,167,215,224,244,115,59,82,213,219,163,139,144,123,192,55,226,176,221,247,11,63,202,189,167,232,0,4,138,189,232,38,91,63,102,211,215,147,144,109,128,135,193,232,224,175,248,198,81,220,72,128,0,50,126,197,231,90,145,44,253,144,158,255,151,236,168,16,248,61,24,252,59,140,101,30,140,136,0,2,221,157,215,78,85,56,150,70,238,45,56,129,199,168,229,234,115,43,105,218,87,242,202,0,3,135,208,200,180,117,15,253,227,123,234,104,201,245,17,192,50,121,59,95,140,68,131,115,125,103,32,0,16,142,70,181,120,253,180,134,116,245,91,80,10,102,6,189,87,251,125,143,93,156,160,0,11,75,167,207,230,235,50,253,106,243,60,113,153,251,240,50,121,59,88,207,125,154,206,250,206,64,0,36,246,181,175,143,183,198,247,212,209,150,109,123,96,64,103,41,63,143,107,217,173,199,128,0,7,29,223,210,214,181,65,114,218,67,46,29,233,177,64,27,241,88,110,255,215,34,195,223,1,202,0,3,183,18,235,91,136,21,171,183,71,113,107,139,2,47,241,101,209,137,22,234,72,201,152,0,7,62,78,51,225,30,239,246,249,108,253,155,79,94,87,184,13,248,172,55,125,44,224,187,221,128,0,38,87,138,61,62,102,53,89,15,251,124,149,55,83,157,164,160,16,25,202,77,204,59,143,165,174,207,40,0,11,135,70,189,86,226,231,242,187,253,190,91,63,102,211,214,111,186,202,5,51,3,94,124,175,15,209,93,208,0,7,139,201,175,92,255,188,183,215,175,90,67,46,29,254,109,214,80,41,152,26,222,255,119,246,170,254,229,0,1,180,244,123,252,212,249,188,199,59,235,149,247,216,234,89,98,135,1,1,156,164,207,219,210,27,47,90,8,0,3,126,206,110,146,150,142,235,28,215,156,166,224,55,14,255,53,59,40,56,242,240,221,231,25,114,99,245,152,109,128,0,114,187,85,124,123,123,159,115,64,122,229,99,157,133,127,140,220,132,12,60,226,146,105,158,227,155,163,209,160,192,0,57,30,252,71,168,125,5,138,186,90,243,148,220,6,225,223,204,167,101,7,30,94,27,191,45,202,129,175,85,182,0,1,113,163,174,210,47,208,160,61,101,30,117,253,28,95,214,155,1,103,185,178,194,77,82,156,220,207,248,0,9,31,175,91,95,226,219,236,221,176,80,89,246,252,111,172,175,179,19,182,2,99,249,214,247,151,134,134,183,143,104,0,15,101,29,95,50,113,191,43,191,181,180,167,127,29,252,202,118,80,113,229,225,187,237,178,228,224,181,51,148,0,3,127,165,57,173,44,43,142,78,55,229,119,246,179,94,47,47,191,153,78,202,14,60,188,55,126,209,23,210,173,179,244,0,14,28,245,127,249,96,48,27,175,199,245,13,205,109,99,37,247,160,55,252,48,126,189,114,155,183,212,206,80,0,13,255,218,238,254,79,154,2,219,117,165,219,113,224,175,182,88,190,167,196,5,164,14,223,50,12,144,70,234,21,148,0,14,71,81,7,215,161,79,234,238,93,96,153,56,127,181,92,220,151,248,8,55,46,78,241,43,198,232,130,140,154,128,0,134,65,127,237,176,136,11,109,214,151,109,199,63,11,206,226,224,124,64,90,64,237,253,118,171,213,3,175,172,0,2,3,209,186,247,229,239,216,31,45,122,78,87,59,172,239,246,161,160,41,48,212,127,222,222,61,124,20,100,212,0,14,62,133,39,119,30,175,197,175,11,134,155,216,86,255,111,250,5,151,58,78,97,8,64,198,250,221,128,0,227,205,196,73,255,226,94,150,253,129,233,214,56,201,229,93,245,216,115,50,129,73,134,163,46,111,153,209,197,251,64,0,180,160,149,248,207,220,122,191,22,188,46,28,106,27,89,212,167,232,22,92,233,57,166,94,62,133,99,38,160,0,90,98,161,90,197,246,50,14,54,207,78,177,198,78,101,223,92,223,163,60,5,151,58,79,175,154,191,108,189,110,192,0,111,224,218,62,176,101,242,157,175,11,135,26,134,215,203,157,109,128,176,226,99,125,222,39,251,171,239,61,128,1,191,222,72,121,185,151,54,209,124,167,107,194,225,160,57,180,113,16,27,96,47,93,60,239,187,196,183,103,115,56,16,0,45,61,26,210,196,28,109,158,157,99,140,159,177,141,86,255,156,2,228,241,107,24,255,113,167,201,255,254,96,0,34,253,103,202,205,59,115,181,166,234,61,223,218,128,249,191,253,233,241,192,55,203,58,221,123,215,31,123,71,51,129,0,3,39,155,171,180,139,141,179,211,172,113,208,190,249,189,226,182,237,250,5,201,226,215,103,43,190,43,214,107,48,0,2,31,107,212,157,254,249,102,39,89,231,101,156,224,35,62,125,132,13,242,206,183,84,185,122,29,77,96,114,128,3,140,247,252,209,232,231,254,87,139,63,39,215,173,37,212,253,78,190,79,208,47,148,237,67,228,92,127,186,233,200,128,0,131,193,86,239,254,223,44,196,235,60,236,179,156,5,47,159,192,129,105,186,143,119,187,34,254,150,172,121,64,1,208,248,80,26,159,99,174,25,127,243,222,85,30,193,125,44,203,188,76,6,248,87,91,168,146,86,210,247,169,159,248,0,27,238,213,140,188,185,24,95,31,199,245,187,116,189,26,95,63,206,2,211,117,229,119,221,36,125,10,192,255,128,1,195,21,174,53,152,117,29,82,195,137,141,233,229,227,239,61,45,166,23,239,34,2,206,150,128,204,224,80,142,70,188,159,160,0,201,176,106,63,219,89,76,104,248,92,61,143,7,163,206,146,149,2,2,219,117,165,136,24,47,71,190,31,42,3,145,10,203,58,250,150,207,30,43,53,129,143,248,176,87,143,239,161,13,155,243,239,94,133,138,251,130,129,231,88,175,182,237,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,157,154,31,39,147,201,228,218,204,96,210,217,242,199,25,207,188,91,103,139,85,223,243,252,78,254,14,92,241,224,250,58,91,127,182,237,112,24,104,220,143,215,238,96,59,93,178,6,93,79,215,157,52,135,44,166,52,124,46,30,198,117,95,132,51,60,4,123,223,230,238,62,236,23,163,223,172,59,59,102,181,173,107,90,214,181,173,107,90,214,181,173,107,90,214,161,210,175,207,151,169,170,47,9,76,239,185,244,114,131,143,87,114,234,201,105,244,235,181,202,145,227,244,202,214,181,173,107,90,214,181,173,107,90,214,181,173,107,90,237,101,80,105,149,31,11,135,24,157,86,117,63,231,128,143,80,243,112,178,188,111,232,225,34,71,12,69,90,214,181,173,107,90,214,181,173,107,90,214,181,173,107,95,255,29,221,191,225,131,204,135,48,14,202,217,238,249,186,160,50,113,188,119,87,204,182,125,101,125,133,62,254,155,173,107,90,214,181,173,107,90,214,181,173,107,90,214,181,171,93,189,103,185,178,247,74,239,217,248,81,196,127,25,224,32,57,25,223,95,225,179,241,212,242,227,125,130,173,107,90,214,181,196,224,112,56,27,119,131,193,224,240,120,60,30,15,5,252,222,243,6,195,217,220,220,191,135,59,157,206,231,67,238,139,163,29,159,177,207,59,175,233,225,127,251,174,207,33,246,150,191,39,186,233,236,99,176,217,215,151,121,197,123,179,33,183,243,127,111,81,143,125,172,220,151,205,47,249,165,242,10,103,42,155,212,250,81,28,43,137,76,192,215,164,197,82,206,59,216,57,160,113,138,173,245,156,229,223,117,163,139,202,132,124,113,221,75,46,75,167,193,236,241,210,240,103,183,107,185,73,206,46,139,135,187,3,156,253,154,194,112,62,92,206,105,155,151,122,112,220,68,15,161,241,252,190,28,236,77,226,7,225,206,158,183,110,221,219,177,137,97,179,169,191,222,113,106,195,197,62,95,153,212,69,17,79,151,122,177,124,255,15,135,122,55,36,199,32,182,238,112,148,187,174,194,17,109,216,110,153,127,75,159,211,185,187,9,189,15,125,166,1,154,136,46,157,135,118,235,110,220,175,15,50,97,121,195,218,67,97,30,206,101,234,157,245,44,182,248,28,110,40,231,254,160,39,153,157,46,219,143,163,203,164,242,98,231,96,57,19,28,239,175,249,140,116,123,246,220,61,42,222,60,61,176,0,113,246,88,232,224,153,59,171,6,190,143,47,40,16,171,125,118,191,237,254,205,98,242,185,51,175,226,183,124,160,0,225,137,190,125,124,172,214,19,59,235,204,130,3,125,44,109,99,139,56,13,79,238,51,223,243,71,17,46,157,128,1,190,122,219,215,164,197,102,117,125,237,116,252,160,227,242,90,228,250,245,165,63,83,251,141,38,176,178,160,0,227,131,219,215,164,197,102,117,125,237,116,252,160,227,242,90,228,255,136,180,222,10,51,245,49,177,193,66,110,63,224,0,111,188,115,53,242,161,16,120,223,94,103,4,6,250,13,227,163,54,237,241,243,233,35,63,93,158,211,215,235,0,1,208,141,215,202,235,173,116,7,175,51,130,3,125,211,227,163,15,196,46,246,89,146,39,59,204,242,233,111,62,112,0,18,119,94,242,20,178,249,117,248,231,248,64,225,194,100,58,200,127,119,249,213,165,234,144,251,45,87,40,0,56,207,176,84,187,110,63,37,174,79,175,247,225,0,98,167,30,87,123,19,149,142,235,219,251,105,176,253,59,103,168,0,11,76,111,88,39,66,115,249,119,200,155,28,160,227,47,198,32,161,61,67,5,94,253,98,213,117,239,151,197,250,0,14,63,158,189,210,187,233,103,234,246,158,217,64,46,95,29,214,150,81,130,175,126,177,226,233,125,45,87,244,0,9,149,105,118,220,98,171,125,122,255,126,16,4,142,13,227,239,230,178,108,171,53,255,112,252,245,154,217,220,224,0,90,114,181,130,100,196,62,87,124,137,177,202,14,59,29,189,122,217,69,223,163,222,36,94,235,75,17,0,1,191,173,214,9,147,16,249,93,242,36,188,14,52,253,189,127,143,242,101,5,241,155,111,244,49,157,110,222,119,232,0,31,204,21,46,219,141,179,229,175,143,165,250,7,182,113,5,25,121,90,174,189,237,252,108,116,119,25,32,0,111,235,171,228,203,195,47,143,119,236,229,224,113,230,226,43,214,223,185,158,62,253,189,240,87,244,101,150,47,208,0,50,97,149,233,57,95,103,171,248,210,252,192,112,235,232,173,223,247,125,1,71,23,151,149,218,171,210,0,1,51,141,204,135,46,79,22,173,119,45,248,25,175,116,203,215,123,21,232,215,217,198,40,205,193,78,97,17,80,0,27,232,215,201,150,211,50,61,223,179,250,217,65,199,209,231,82,76,34,222,202,62,191,235,62,178,187,160,0,29,12,139,94,147,145,133,241,252,120,31,112,28,56,197,198,180,246,251,237,39,198,109,23,57,235,168,248,185,210,160,0,116,50,45,122,76,62,6,55,163,243,121,0,201,157,247,58,243,86,152,213,102,191,233,181,123,237,178,128,1,147,245,43,99,203,103,120,241,255,237,179,80,49,95,60,227,190,121,23,186,212,62,255,5,124,239,156,0,1,138,219,234,119,69,224,30,63,143,161,18,1,23,132,166,119,207,49,95,86,176,48,191,127,176,164,132,253,192,0,64,73,247,158,16,25,202,72,77,234,84,8,92,118,225,255,224,18,15,123,171,198,255,177,71,167,250,0,2,2,79,188,240,128,206,82,103,230,121,224,33,113,219,135,255,128,72,61,238,175,28,50,251,6,168,44,235,218,0,2,193,95,252,242,241,204,104,248,102,89,65,198,129,251,201,204,54,9,3,157,204,224,115,89,220,207,208,0,25,49,54,173,223,188,51,190,27,191,58,156,6,77,211,13,215,155,43,195,193,235,120,151,77,58,157,71,119,31,104,0,4,95,3,91,30,90,111,207,131,204,242,127,128,139,247,68,58,247,191,187,238,186,232,246,18,45,97,126,208,0,9,29,179,83,187,21,17,96,61,224,123,64,56,113,254,15,70,31,237,99,58,245,131,206,38,221,24,204,255,8,0,13,249,202,238,237,241,78,198,142,7,199,42,6,237,210,244,127,244,25,237,141,245,235,251,72,223,88,136,0,7,27,237,99,63,94,95,110,217,184,188,231,128,201,159,34,181,109,242,188,63,157,99,126,121,6,165,61,44,160,0,36,230,125,251,111,51,168,131,250,225,254,152,27,246,31,46,79,107,61,113,220,193,70,125,126,215,95,255,204,0,3,123,88,188,188,125,157,133,36,195,239,33,2,46,91,230,247,138,235,134,214,187,171,45,122,207,126,120,0,14,61,233,35,63,80,207,109,179,113,56,155,1,208,190,249,189,242,58,225,230,215,246,195,117,255,251,64,0,113,237,117,140,253,67,45,212,147,15,191,180,14,203,57,192,82,231,23,9,205,107,215,201,72,128,0,112,231,171,187,183,250,31,62,190,123,184,27,230,146,149,254,229,225,158,43,95,143,248,0,2,78,147,191,109,8,190,89,116,111,62,208,59,44,231,1,241,241,45,220,221,107,228,202,0,3,149,210,175,177,147,216,219,123,207,145,40,27,230,156,218,48,189,182,252,229,107,252,78,54,0,0,4,127,107,223,182,128,232,120,254,52,59,0,12,159,177,141,86,227,251,191,96,232,235,221,231,0,0,123,99,115,36,78,118,6,79,175,191,157,128,128,249,191,253,253,153,114,122,53,239,35,196,67,128,0,113,249,40,225,37,120,192,237,235,59,238,192,55,111,227,107,75,149,201,141,215,71,211,0,0,155,87,189,189,97,193,198,244,113,25,64,139,234,115,53,126,232,100,90,198,111,224,178,128,0,225,224,245,156,229,223,241,215,243,244,0,143,78,108,49,159,202,15,209,174,126,106,0,1,179,145,245,224,92,60,170,237,247,96,22,11,205,150,226,156,228,237,53,13,148,253,0,1,199,201,5,75,158,91,233,63,240,54,240,34,233,124,254,252,140,189,11,6,163,253,176,0,9,5,3,175,3,145,200,215,51,6,6,252,236,234,141,229,190,89,140,235,33,248,229,64,0,32,118,153,146,36,226,142,100,126,220,6,79,43,99,168,99,134,251,34,215,103,158,0,0,144,123,221,120,18,59,94,185,152,48,55,240,223,209,142,229,227,230,248,53,95,51,40,0,6,43,234,214,248,232,88,53,204,129,3,127,13,253,25,56,115,253,123,198,184,50,61,42,0,1,23,186,212,254,180,143,87,111,240,3,143,5,136,147,218,207,64,0,7,14,210,142,47,47,31,78,191,251,240,57,95,204,79,169,16,0,0,144,115,117,60,185,29,93,126,0,113,207,194,243,187,140,115,13,125,253,0,0,35,240,93,231,135,101,157,212,8,27,237,62,72,42,89,158,239,136,233,74,0,0,16,58,204,136,31,204,23,127,32,28,54,116,27,90,155,125,40,255,132,0,0,145,255,235,99,203,208,176,107,157,148,10,119,195,171,173,125,145,178,217,128,0,2,211,26,174,215,253,191,173,214,23,252,7,42,95,31,217,164,175,124,119,243,164,188,197,32,0,11,62,149,108,121,122,22,13,89,101,2,13,184,236,123,79,29,29,102,120,113,185,43,135,108,0,3,127,195,163,227,163,238,149,223,215,87,255,48,1,114,118,125,118,15,90,247,103,231,82,240,0,14,52,119,91,60,221,96,150,126,181,218,254,128,167,237,110,223,138,215,190,231,35,201,88,164,32,0,55,252,48,27,28,21,127,243,203,210,130,239,24,3,127,231,70,243,222,219,90,204,57,252,22,191,185,224,0,30,59,47,141,1,173,75,62,158,217,201,141,215,228,1,226,189,207,145,14,68,214,189,97,30,219,180,64,0,7,31,54,199,49,206,235,82,125,68,79,76,112,196,181,255,204,0,35,214,42,31,226,181,165,192,112,177,87,39,244,0,27,254,63,142,150,181,235,198,223,154,255,44,55,90,252,0,56,240,80,172,21,7,214,191,28,28,151,201,125,202,0,12,213,239,241,240,196,235,94,232,79,215,167,101,73,240,21,248,0,50,13,198,235,222,238,38,117,172,111,159,176,231,192,1,77,252,65,255,191,157,107,25,155,183,224,118,203,72,155,95,207,47,40,5,55,241,15,223,183,173,107,236,141,150,204,0,3,149,7,194,119,217,164,175,124,133,224,218,223,147,104,46,249,255,32,3,161,57,251,109,142,181,169,250,25,27,122,185,192,2,23,139,198,178,255,52,117,153,142,255,124,239,214,249,234,251,245,32,191,240,55,224,12,158,102,111,225,124,173,113,57,7,227,176,221,101,0,31,141,166,18,43,214,189,225,31,151,244,223,61,91,47,80,85,219,225,178,128,58,233,143,97,222,15,71,90,172,6,231,254,0,50,12,36,241,43,90,247,138,190,72,233,190,37,221,96,160,171,255,129,183,128,17,206,127,143,167,185,214,189,121,157,85,130,19,254,0,63,182,239,253,199,90,212,251,121,134,120,73,29,230,207,25,214,181,2,0,111,186,100,55,37,175,90,232,224,97,94,15,217,80,6,77,199,239,207,173,107,119,179,146,226,90,97,231,156,115,90,214,49,106,188,197,128,27,247,120,116,214,155,173,122,228,23,71,153,158,0,127,49,218,119,209,90,210,194,177,201,214,217,198,239,12,235,160,171,93,207,199,111,186,0,25,48,170,6,75,243,141,214,165,150,31,238,55,52,0,83,239,226,46,53,175,121,28,227,15,224,33,19,124,63,149,90,252,115,248,4,230,111,158,0,25,63,222,158,18,111,71,90,248,114,164,31,91,234,0,114,51,127,94,115,5,90,200,125,28,201,145,147,216,225,126,90,215,191,213,143,221,188,128,1,208,179,192,223,40,235,88,185,111,155,129,202,3,21,235,214,68,250,215,175,246,239,29,244,200,245,195,225,64,107,92,233,151,217,200,210,252,160,1,112,181,102,161,208,85,175,146,135,221,192,0,145,227,241,13,63,90,245,159,164,174,211,177,206,193,115,238,181,173,198,111,143,92,192,0,227,98,147,219,227,125,110,181,235,76,138,59,9,119,232,28,175,155,19,185,214,179,56,204,186,239,105,10,151,68,121,221,102,93,250,175,220,84,160,0,17,235,133,205,79,214,181,25,237,247,228,96,75,46,31,151,149,90,198,118,191,42,75,244,234,179,157,77,131,89,158,25,250,159,215,78,192,0,111,218,99,63,78,245,90,247,243,47,147,28,160,195,74,76,115,186,213,218,7,102,75,244,183,243,237,126,58,210,218,64,118,156,153,80,0,24,4,234,7,27,219,214,189,241,220,2,79,197,118,4,54,229,232,88,53,172,94,31,155,125,149,113,166,115,255,56,221,99,23,207,179,31,137,128,0,59,127,31,165,37,52,130,173,118,240,206,127,35,16,24,175,191,78,247,203,214,189,103,204,102,46,106,114,123,46,94,15,94,238,68,119,129,249,50,128,0,75,48,25,111,159,90,247,124,190,25,232,113,221,250,171,230,198,207,90,245,129,198,34,8,164,228,204,176,151,220,30,161,125,40,237,239,171,202,0,1,195,143,249,187,79,179,173,122,243,48,190,149,235,252,113,160,99,251,156,141,204,214,176,179,76,126,129,249,50,184,99,176,122,62,234,78,254,100,191,19,135,219,0,0,58,24,255,130,83,11,27,173,99,31,8,207,173,187,101,57,56,188,123,181,235,90,230,121,113,188,233,9,201,157,120,172,87,53,111,31,44,182,230,180,0,0,45,37,255,137,183,35,227,173,102,68,247,137,116,169,233,116,176,146,13,107,51,195,180,255,90,231,147,241,37,204,190,217,234,89,228,144,96,110,80,0,1,49,231,205,48,122,214,103,5,118,133,114,127,81,217,204,63,113,71,90,249,251,237,47,94,195,195,121,229,203,103,122,250,116,207,101,149,59,40,0,0,167,237,112,244,149,175,120,24,200,26,25,217,142,94,227,158,218,215,188,249,184,183,68,112,231,25,165,142,3,63,109,239,154,242,77,61,249,184,0,0,115,249,241,222,108,46,146,181,254,49,249,151,4,134,246,237,191,74,181,239,103,18,94,246,242,18,57,73,49,220,206,253,241,216,146,247,238,240,128,0,7,29,223,210,218,96,227,117,175,94,118,198,215,143,77,61,14,221,29,106,23,253,251,242,224,196,130,195,17,242,187,41,57,14,230,153,33,0,0,7,66,115,214,92,43,94,247,68,227,229,255,243,190,213,107,222,227,155,182,75,165,27,249,57,96,59,194,97,55,29,204,77,50,202,0,0,9,31,38,197,249,109,53,173,107,93,63,38,235,252,94,177,28,171,134,39,179,143,204,48,31,112,0,0,27,232,123,73,231,153,134,173,107,95,143,81,193,99,153,92,63,141,243,62,3,203,178,142,113,206,0,0,0,201,231,228,61,215,63,105,173,107,197,46,177,127,139,146,83,197,116,110,44,114,87,38,120,0,0,6,254,10,7,159,27,173,93,179,147,198,216,229,80,211,127,105,124,248,217,238,61,40,0,0,1,142,88,253,222,26,252,123,24,11,185,77,206,125,252,23,169,89,14,226,36,0,0,0,227,61,202,90,245,214,244,240,191,103,131,150,146,251,172,156,115,30,187,76,161,63,224,0,0,4,34,111,176,244,105,135,14,119,201,1,159,203,51,161,244,192,0,0,3,125,134,227,232,195,55,127,207,195,42,0,0,0,25,175,101,247,167,236,230,123,64,0,0,3,143,188,254,96,211,175,104,0,0,0,113,150,250,82,82,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0};
-#endif
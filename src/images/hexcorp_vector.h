@@ -0,0 +1,5 @@
+#ifndef HEXCORP_VECTOR
+#define HEXCORP_VECTOR
+// generated by assets/make-vector.ts from hexcorp.svg
+const unsigned char hexcorp_vector[171] = {208,7,208,7,1,255,102,255,2,240,48,128,9,3,16,14,128,23,3,16,14,224,88,3,96,60,144,109,3,96,97,80,91,3,80,97,0,35,3,144,96,16,34,3,0,95,240,33,3,32,94,224,34,3,144,83,0,58,3,32,35,32,58,3,240,25,64,78,3,0,26,176,30,3,80,60,160,13,3,160,103,144,32,3,112,103,224,93,3,224,68,48,111,3,192,106,80,96,3,144,106,32,30,3,0,60,64,10,3,240,22,144,28,3,16,23,16,84,3,192,23,128,85,3,0,25,192,85,3,208,25,0,85,3,240,36,16,61,3,240,85,208,60,3,96,94,144,41,3,96,94,112,89,3,48,60,16,106,3,224,16,48,87,3,16,17,128,25,6,7,0};
+#endif
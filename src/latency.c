@@ -0,0 +1,69 @@
+#include "latency.h"
+
+#include <stdio.h>
+
+void latencyInit(Latency* latency) {
+	latency->count = 0;
+	latency->next = 0;
+	latency->sinceReport = 0;
+	latency->stage = LATENCY_STAGES;
+}
+
+void latencyBegin(Latency* latency, uint32_t irq, uint32_t dequeue,
+                  uint32_t change) {
+	latency->current.times[LATENCY_IRQ] = irq;
+	latency->current.times[LATENCY_DEQUEUE] = dequeue;
+	latency->current.times[LATENCY_SWITCH] = change;
+	latency->stage = LATENCY_RENDER;
+}
+
+bool latencyWaiting(Latency* latency, LatencyStage stage) {
+	return latency->stage == stage;
+}
+
+void latencyMark(Latency* latency, LatencyStage stage, uint32_t time) {
+	if (stage != latency->stage) return;
+
+	latency->current.times[stage] = time;
+	latency->stage++;
+	if (latency->stage < LATENCY_STAGES) return;
+
+	latency->samples[latency->next] = latency->current;
+	latency->next = (latency->next + 1) % LATENCY_SAMPLES;
+	if (latency->count < LATENCY_SAMPLES) latency->count++;
+
+	if (++latency->sinceReport >= LATENCY_REPORT_EVERY) {
+		latency->sinceReport = 0;
+		latencyReport(latency);
+	}
+}
+
+static const char* stageNames[LATENCY_STAGES] = {
+    "irq", "dequeue", "switch", "render", "flush",
+};
+
+void latencyReport(Latency* latency) {
+	if (latency->count == 0) return;
+
+	printf("latency from irq, %u screen changes\n", latency->count);
+
+	uint32_t sorted[LATENCY_SAMPLES];
+	for (uint8_t stage = LATENCY_DEQUEUE; stage < LATENCY_STAGES; stage++) {
+		// insertion sort, it's only 64
+		for (uint8_t i = 0; i < latency->count; i++) {
+			LatencySample* sample = &latency->samples[i];
+			uint32_t value = sample->times[stage] - sample->times[LATENCY_IRQ];
+
+			uint8_t j = i;
+			for (; j > 0 && sorted[j - 1] > value; j--) {
+				sorted[j] = sorted[j - 1];
+			}
+			sorted[j] = value;
+		}
+
+		uint8_t last = latency->count - 1;
+		printf("  %-8s p50 %6luus  p99 %6luus\n", stageNames[stage],
+		       (unsigned long)sorted[last * 50 / 100],
+		       (unsigned long)sorted[last * 99 / 100]);
+	}
+}
@@ -0,0 +1,53 @@
+#ifndef MAKI_LATENCY_H
+#define MAKI_LATENCY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// touch to photon timing for screen changes. one change is tracked at a
+// time through each stage, and finished ones go into a ring buffer. every
+// LATENCY_REPORT_EVERY of them, p50 and p99 from the interrupt to each
+// stage are printed over stdio
+//
+// times are time_us_32
+
+#define LATENCY_SAMPLES 64
+#define LATENCY_REPORT_EVERY 16
+
+typedef enum {
+	LATENCY_IRQ,  // touch interrupt
+	LATENCY_DEQUEUE,  // main loop took it off the touch queue
+	LATENCY_SWITCH,  // gesture asked for another screen
+	LATENCY_RENDER,  // new screen rendered
+	LATENCY_FLUSH,  // core1 finished sending it
+	LATENCY_STAGES,
+} LatencyStage;
+
+typedef struct {
+	uint32_t times[LATENCY_STAGES];
+} LatencySample;
+
+typedef struct {
+	LatencySample samples[LATENCY_SAMPLES];
+	uint8_t count;
+	uint8_t next;
+	uint8_t sinceReport;
+
+	LatencySample current;
+	// stage current is waiting for, LATENCY_STAGES when idle
+	LatencyStage stage;
+} Latency;
+
+void latencyInit(Latency* latency);
+
+// starts tracking, replacing one still in progress
+void latencyBegin(Latency* latency, uint32_t irq, uint32_t dequeue,
+                  uint32_t change);
+
+// ignored unless it's the stage being waited for
+void latencyMark(Latency* latency, LatencyStage stage, uint32_t time);
+bool latencyWaiting(Latency* latency, LatencyStage stage);
+
+void latencyReport(Latency* latency);
+
+#endif
@@ -3,27 +3,108 @@
 
 #include "CST816S.h"
 #include "LCD_1in28.h"
+#include "assets.h"
+#include "fade.h"
+#include "gesture.h"
+#include "latency.h"
+#include "parallel.h"
+#include "pico/stdlib.h"
+#include "pipeline.h"
+#include "scheduler.h"
+#include "screen_manager.h"
+#include "screens/game_of_life_screen.h"
 #include "screens/hexcorp_screen.h"
 #include "screens/maki_profile_picture_screen.h"
-// #include "screens/mechanyx_screen.h"
-// #include "screens/game_of_life_screen.h"
+#include "screens/mechanyx_screen.h"
+#include "touch_queue.h"
+#include "transition.h"
 
-uint8_t currentScreen = 0;
-#define MAX_SCREENS 1
+ScreenManager screenManager;
+Scheduler scheduler;
+TouchQueue touchQueue;
+GestureEngine gestures;
+Latency latency;
+Transition transition;
+Fade fade;
 
+#define TRANSITION_MS 300
+// picked by whatever asked for the next screen
+TransitionType nextTransition = TRANSITION_CROSSFADE;
+
+// no i2c in here, the main loop reads the controller
 void Touch_INT_callback(uint gpio, uint32_t events) {
 	if (gpio == Touch_INT_PIN) {
-		if (Touch_CTS816.mode == CST816S_Gesture_Mode) {
-			uint8_t gesture = CST816S_Get_Gesture();
-			if (gesture == CST816S_Gesture_Long_Press) {
-				if (currentScreen >= MAX_SCREENS) {
-					currentScreen = 0;  // reset back to 0
-				} else {
-					currentScreen++;
-				}
-			}
+		touchQueuePush(&touchQueue, time_us_32(), events);
+		schedulerWake(&scheduler);
+	}
+}
+
+// a drag starting this close to the top pulls a shade down
+#define SHADE_EDGE 40
+#define SHADE_BRIGHTNESS (FADE_FULL / 4)
+
+// true when it changed screen
+bool handleGesture(Gesture* gesture) {
+	// the shade only dims rows on their way out, so following the finger
+	// costs a send and no render
+	if (gesture->type == GESTURE_DRAG && gestures.startY < SHADE_EDGE) {
+		fadeSetRows(&fade, 0, gesture->y, SHADE_BRIGHTNESS);
+		fadeSetRows(&fade, gesture->y, FADE_HEIGHT, FADE_FULL);
+	} else if (gesture->type != GESTURE_DRAG) {
+		fadeSetRows(&fade, 0, FADE_HEIGHT, FADE_FULL);
+	}
+
+	switch (gesture->type) {
+		case GESTURE_LONG_PRESS:
+			nextTransition = TRANSITION_CROSSFADE;
+			screenManagerNext(&screenManager);
+			return true;
+		case GESTURE_SWIPE_LEFT:
+			nextTransition = TRANSITION_PUSH_LEFT;
+			screenManagerNext(&screenManager);
+			return true;
+		case GESTURE_SWIPE_RIGHT:
+			nextTransition = TRANSITION_PUSH_RIGHT;
+			screenManagerPrevious(&screenManager);
+			return true;
+		default:
+			return false;
+	}
+}
+
+void handleTouch(void) {
+	Gesture gesture;
+
+	// the sample that finished the gesture, for latency
+	static uint32_t irq, dequeue;
+
+	TouchEvent event;
+	while (touchQueuePop(&touchQueue, &event)) {
+		irq = event.time;
+		dequeue = time_us_32();
+
+		// gesture, fingers and position in one read
+		CST816S_Touch touch;
+		CST816S_Read_Touch(&touch);
+
+#ifdef GESTURE_TRACE
+		// replay with GESTURE_HOST_REPLAY, see gesture.h
+		printf("%u %d %d %d\n", event.time, touch.fingers > 0, touch.x_point,
+		       touch.y_point);
+#endif
+
+		if (gestureSample(&gestures, event.time, touch.fingers > 0,
+		                  touch.x_point, touch.y_point, &gesture) &&
+		    handleGesture(&gesture)) {
+			latencyBegin(&latency, irq, dequeue, time_us_32());
 		}
 	}
+
+	// held still or let go without a sample
+	if (gestureUpdate(&gestures, time_us_32(), &gesture) &&
+	    handleGesture(&gesture)) {
+		latencyBegin(&latency, irq, dequeue, time_us_32());
+	}
 }
 
 int main(void) {
@@ -36,55 +117,158 @@ int main(void) {
 	LCD_1IN28_Init(HORIZONTAL);
 	LCD_1IN28_Clear(0x0000);
 
-	DEV_SET_PWM(100);
+	// backlight stays off until the first frame is out
+	fadeInit(&fade);
 
 	// init gestures
 
-	CST816S_init(CST816S_Gesture_Mode);
+	// raw points, gestures are recognized here
+	touchQueueInit(&touchQueue);
+	gestureInit(&gestures);
+	latencyInit(&latency);
+	CST816S_init(CST816S_Point_Mode);
 	DEV_KEY_Config(Touch_INT_PIN);
 	DEV_IRQ_SET(Touch_INT_PIN, GPIO_IRQ_EDGE_RISE, &Touch_INT_callback);
 
-	// init screens states
+	// init screens, assets are decoded when a screen is first shown
 
 	uint16_t buffer[LCD_1IN28_WIDTH * LCD_1IN28_HEIGHT];
-	uint8_t lastScreen = MAX_SCREENS + 1;
 
-	// HexCorpScreenState hexCorpScreenState;
-	// InitHexCorpScreenState(&hexCorpScreenState);
+	// core1 flushes while core0 renders
+#ifdef PIPELINE_DOUBLE_BUFFER
+	static uint16_t backBuffer[LCD_1IN28_WIDTH * LCD_1IN28_HEIGHT];
+	pipelineInit(&fade, buffer, backBuffer);
+#else
+	pipelineInit(&fade, buffer, NULL);
+#endif
+
+	// and helps render whenever it isn't flushing
+	parallelInit();
+
+	assetCacheInit(&assetCache, assets, ASSET_COUNT, ASSETS_BUDGET);
+	transitionInit(&transition, &assetCache);
+	screenManagerInit(&screenManager);
 
 	MakiProfilePictureScreenState makiProfilePictureScreenState;
-	InitMakiProfilePictureScreenState(&makiProfilePictureScreenState);
+	Screen makiProfilePictureScreen = {
+	    .name = "maki",
+	    .state = &makiProfilePictureScreenState,
+	    // only the battery changes, every few seconds
+	    .fps = 2,
+	    .init = MakiProfilePictureScreenInit,
+	    .enter = MakiProfilePictureScreenEnter,
+	    .render = MakiProfilePictureScreenRender,
+	    .leave = MakiProfilePictureScreenLeave,
+	    .prefetch = MakiProfilePictureScreenPrefetch,
+	};
+	screenManagerAdd(&screenManager, &makiProfilePictureScreen);
+
+	Screen hexCorpScreen = {
+	    .name = "hexcorp",
+	    .fps = 1,
+	    .render = HexCorpScreenRender,
+	};
+	screenManagerAdd(&screenManager, &hexCorpScreen);
+
+	Screen mechanyxScreen = {
+	    .name = "mechanyx",
+	    .fps = 1,
+	    .render = MechanyxScreenRender,
+	};
+	screenManagerAdd(&screenManager, &mechanyxScreen);
 
-	// GameOfLifeScreenState gameOfLifeScreenState;
-	// InitGameOfLifeScreenState(&gameOfLifeScreenState);
+	GameOfLifeScreenState gameOfLifeScreenState;
+	Screen gameOfLifeScreen = {
+	    .name = "game of life",
+	    .state = &gameOfLifeScreenState,
+	    .init = GameOfLifeScreenInit,
+	    .enter = GameOfLifeScreenEnter,
+	    .render = GameOfLifeScreenRender,
+	    .leave = GameOfLifeScreenLeave,
+	};
+	screenManagerAdd(&screenManager, &gameOfLifeScreen);
 
-	// update and draw
+	// update and draw, sleeping in between
+
+	schedulerInit(&scheduler, screenManagerFps(&screenManager));
+
+	// submits before the tracked screen change rendered
+	uint32_t latencySubmits = 0;
 
 	while (1) {
-		bool firstDraw = lastScreen != currentScreen;
-		lastScreen = currentScreen;
-
-		bool needsDraw = true;
-
-		switch (currentScreen) {
-				// case 0:
-				// 	needsDraw =
-				// 	    HexCorpScreen(&hexCorpScreenState, buffer, firstDraw);
-				// 	break;
-			case 0:
-				needsDraw = MakiProfilePictureScreen(
-				    &makiProfilePictureScreenState, buffer, firstDraw);
-				break;
-				// case 3:
-				// 	needsDraw = MakiProfilePictureScreen(buffer, firstDraw);
-				// 	break;
-				// case 0:
-				//     needsDraw = GameOfLifeScreen(&gameOfLifeScreenState,
-				//     buffer, firstDraw); break;
+		handleTouch();
+
+		uint32_t now = to_ms_since_boot(get_absolute_time());
+		bool needsDraw = false;
+
+		if (transitionActive(&transition)) {
+			// neither screen renders until it's done
+			transitionStep(&transition, now);
+		} else {
+			uint16_t* target = pipelineBuffer();
+
+			// the first screen just appears
+			bool first = screenManager.current < 0;
+			if (screenManagerSwitch(&screenManager) && !first) {
+				target = transitionBegin(&transition, nextTransition, target,
+				                         TRANSITION_MS, now);
+			}
+
+			needsDraw = screenManagerRender(&screenManager, target);
+			if (needsDraw && latencyWaiting(&latency, LATENCY_RENDER)) {
+				latencyMark(&latency, LATENCY_RENDER, time_us_32());
+				latencySubmits = pipelineSubmits();
+			}
+
+			// its steps send from the next loop on
+			if (transitionActive(&transition)) needsDraw = false;
+		}
+
+		// row fades change what's sent, not what's rendered
+		if (fadeUpdate(&fade, now) && !transitionActive(&transition)) {
+			needsDraw = true;
 		}
 
+		bool moving = fadeActive(&fade) || transitionActive(&transition);
+
 		if (needsDraw) {
-			LCD_1IN28_Display(buffer);
+			pipelineSubmit();
+		} else if (!moving && !pipelineBusy()) {
+			// nothing moving, decode what the next screen will want. a
+			// slice at a time, so a touch only waits for the current one
+			while (schedulerIdle(&scheduler) && assetCacheIdle(&assetCache)) {
+			}
+		}
+
+		// the first submit since rendering, once it's out. core1 keeps the
+		// time, so it doesn't matter when this notices
+		if (latencyWaiting(&latency, LATENCY_FLUSH) &&
+		    pipelineSubmits() != latencySubmits && !pipelineBusy()) {
+			latencyMark(&latency, LATENCY_FLUSH, pipelineFlushedAt());
+		}
+
+		// first frame is out
+		if (fade.to == 0) {
+			fadeTo(&fade, FADE_FULL, 400, now);
+		}
+
+		// fades, transitions and touches need every frame whatever the
+		// screen wants
+		bool active = moving || gestureActive(&gestures);
+		schedulerSetFps(&scheduler, active ? SCHEDULER_DEFAULT_FPS
+		                                   : screenManagerFps(&screenManager));
+
+		// a touch wakes it early to be read, but only a screen switch
+		// renders before the frame is due. otherwise a finger down would
+		// run the screen at the touch controller's rate
+		while (schedulerWait(&scheduler)) {
+			handleTouch();
+			if (screenManagerPending(&screenManager)) break;
+
+			// a finger down wants every frame, see above
+			if (gestureActive(&gestures)) {
+				schedulerSetFps(&scheduler, SCHEDULER_DEFAULT_FPS);
+			}
 		}
 	}
 
@@ -94,6 +278,8 @@ int main(void) {
 
 	// cleanup
 
+	pipelineWait();
+	screenManagerDeinit(&screenManager);
 	DEV_Module_Exit();
 	return 0;
 }
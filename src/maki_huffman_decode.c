@@ -1,5 +1,6 @@
 #include "maki_huffman_decode.h"
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -107,22 +108,29 @@ uint32_t getDecodedSize(const uint8_t* data, uint32_t pos) {
 	return READ_UINT32(data, pos + 1);
 }
 
-void huffmanDecode(const uint8_t* data, uint32_t* size, uint32_t pos,
-                   uint8_t* decodedData, const uint32_t decodedSize) {
-	const uint8_t bitsToIgnoreAtEnd = data[pos++];
+// one round's tree and position, kept between steps
 
-	pos += 4;  // decoded size;
+static bool beginRound(MakiHuffmanDecoder* decoder) {
+	const uint8_t* data = decoder->data;
+	// only the initial data starts with the rounds
+	uint32_t pos = decoder->round == 0 ? 1 : 0;
 
-	const uint32_t totalNodes = READ_UINT32_MOVE_POS(data, pos);
+	decoder->bitsToIgnoreAtEnd = data[pos++];
+	decoder->outputSize = READ_UINT32(data, pos);
+	pos += 4;
+	const uint32_t totalNodes = READ_UINT32(data, pos);
+	pos += 4;
 
 	// unpack node array
 
-	DecodeNode nodeArray[totalNodes];
+	decoder->nodes = malloc(totalNodes * sizeof(DecodeNode));
+	decoder->output = malloc(decoder->outputSize);
+	if (decoder->nodes == NULL || decoder->output == NULL) return false;
 
 	// pos currently at node array
 
 	DecodeNodeProcessing decodeNodeProcessing;
-	decodeNodeProcessing.nodeArray = nodeArray;
+	decodeNodeProcessing.nodeArray = decoder->nodes;
 	decodeNodeProcessing.nodeArrayPos = pos;
 
 	// byte array is ceil(totalNodes / 4) away
@@ -134,19 +142,68 @@ void huffmanDecode(const uint8_t* data, uint32_t* size, uint32_t pos,
 	decodeNodeProcessing.data = data;
 	decodeNodeProcessing.pos = pos;
 
-	DecodeNode* rootNode = processDecodeNode(&decodeNodeProcessing);
-	pos = decodeNodeProcessing.pos;
+	decoder->root = processDecodeNode(&decodeNodeProcessing);
+	decoder->current = decoder->root;
+	decoder->pos = decodeNodeProcessing.pos;
+	decoder->bitPos = 0;
+	decoder->outputIndex = 0;
 
-	// unpack data
+	return true;
+}
+
+static void freeRound(MakiHuffmanDecoder* decoder) {
+	free(decoder->nodes);
+	decoder->nodes = NULL;
+	// not initial
+	if (decoder->round > 0) free((uint8_t*)decoder->data);
+	decoder->data = NULL;
+}
+
+void makiHuffmanDecodeCancel(MakiHuffmanDecoder* decoder) {
+	freeRound(decoder);
+	free(decoder->output);
+	decoder->output = NULL;
+	decoder->round = decoder->rounds;
+}
+
+bool makiHuffmanDecodeBegin(MakiHuffmanDecoder* decoder, const uint8_t* data,
+                            uint32_t size) {
+	decoder->data = data;
+	decoder->size = size;
+	decoder->rounds = data[0];
+	decoder->round = 0;
+	decoder->nodes = NULL;
+	decoder->output = NULL;
+	printf("%u rounds\n", decoder->rounds);
 
-	uint8_t bitPos = 0;
+	if (decoder->rounds > 0 && beginRound(decoder)) return true;
 
-	uint32_t decodedDataIndex = 0;
+	makiHuffmanDecodeCancel(decoder);
+	return false;
+}
+
+bool makiHuffmanDecodeStep(MakiHuffmanDecoder* decoder, uint32_t bytes) {
+	if (decoder->round == decoder->rounds) return true;
 
-	DecodeNode* currentNode = rootNode;
+	// unpack data
 
-	while (pos < *size) {
-		if (pos == *size - 1 && bitPos > 7 - bitsToIgnoreAtEnd) break;
+	const uint8_t* data = decoder->data;
+	const uint32_t size = decoder->size;
+	uint32_t pos = decoder->pos;
+	uint8_t bitPos = decoder->bitPos;
+	uint32_t decodedDataIndex = decoder->outputIndex;
+	uint32_t stopAt = decoder->outputSize - decodedDataIndex > bytes
+	                      ? decodedDataIndex + bytes
+	                      : decoder->outputSize;
+	DecodeNode* currentNode = decoder->current;
+	bool roundDone = true;
+
+	while (pos < size) {
+		if (pos == size - 1 && bitPos > 7 - decoder->bitsToIgnoreAtEnd) break;
+		if (decodedDataIndex == stopAt) {
+			roundDone = decodedDataIndex == decoder->outputSize;
+			break;
+		}
 
 		uint8_t bit = getNextBit(data, &pos, &bitPos);
 
@@ -157,10 +214,33 @@ void huffmanDecode(const uint8_t* data, uint32_t* size, uint32_t pos,
 		}
 
 		if (currentNode->hasByte) {
-			decodedData[decodedDataIndex++] = currentNode->byte;
-			currentNode = rootNode;
+			decoder->output[decodedDataIndex++] = currentNode->byte;
+			currentNode = decoder->root;
 		}
 	}
+
+	decoder->pos = pos;
+	decoder->bitPos = bitPos;
+	decoder->outputIndex = decodedDataIndex;
+	decoder->current = currentNode;
+	if (!roundDone) return false;
+
+	// the output is the next round's input, with its own size
+	freeRound(decoder);
+	decoder->data = decoder->output;
+	decoder->size = decoder->outputSize;
+	decoder->output = NULL;
+	decoder->round++;
+
+	if (decoder->round == decoder->rounds) {
+		// remember to free out of function
+		decoder->output = (uint8_t*)decoder->data;
+		decoder->data = NULL;
+		return true;
+	}
+
+	if (!beginRound(decoder)) makiHuffmanDecodeCancel(decoder);
+	return decoder->round == decoder->rounds;
 }
 
 // running huffman encoding multiple times compresses down really well
@@ -171,47 +251,13 @@ void huffmanDecode(const uint8_t* data, uint32_t* size, uint32_t pos,
 // ...packed
 
 uint8_t* makiHuffmanDecode(const uint8_t* data, uint32_t* size) {
-	uint8_t pos = 0;  // only goes from 0 to 1 to 0 and stays
+	MakiHuffmanDecoder decoder;
+	if (!makiHuffmanDecodeBegin(&decoder, data, *size)) return NULL;
 
-	const uint8_t rounds = data[pos++];
-	printf("%u rounds\n", rounds);
-
-	uint8_t* bufferA = (uint8_t*)data;
-	uint8_t* bufferB = NULL;
-
-	// mallocing a lot here but its getting free'd
-
-	for (uint8_t i = 0; i < rounds; i++) {
-		if (bufferB == NULL) {
-			// decode A into B
-
-			uint32_t decodedSize = getDecodedSize(bufferA, pos);
-			bufferB = malloc(decodedSize);
-
-			huffmanDecode(bufferA, size, pos, bufferB, decodedSize);
-
-			if (pos == 0) free(bufferA);  // not initial
-			pos = 0;
-
-			bufferA = NULL;
-		} else if (bufferA == NULL) {
-			// decode B into A
-
-			uint32_t decodedSize = getDecodedSize(bufferB, pos);
-			bufferA = malloc(decodedSize);
-
-			huffmanDecode(bufferB, size, pos, bufferA, decodedSize);
-
-			if (pos == 0) free(bufferB);  // not initial
-			// pos = 0; // only need to this for the initial A to B
-
-			bufferB = NULL;
-		}
+	while (!makiHuffmanDecodeStep(&decoder, UINT32_MAX)) {
 	}
 
-	// remember to free out of function
-
-	return bufferA == NULL ? bufferB : bufferA;
+	return decoder.output;
 }
 
 // int main() {
@@ -1,8 +1,38 @@
 #ifndef MAKI_HUFFMAN_DECODE_H
 #define MAKI_HUFFMAN_DECODE_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 uint8_t* makiHuffmanDecode(const uint8_t* data, uint32_t* size);
 
-#endif
\ No newline at end of file
+// the same decode a slice at a time, so it can fill idle time without
+// holding anything else up. begin, then step until it returns true and
+// take output, which is NULL if it ran out of memory. free it when done
+typedef struct {
+	const uint8_t* data;  // this round's input
+	uint32_t size;
+	uint8_t rounds;
+	uint8_t round;
+
+	uint8_t* output;
+	uint32_t outputSize;
+	uint32_t outputIndex;
+
+	uint32_t pos;
+	uint8_t bitPos;
+	uint8_t bitsToIgnoreAtEnd;
+	struct DecodeNode* nodes;
+	struct DecodeNode* root;
+	struct DecodeNode* current;
+} MakiHuffmanDecoder;
+
+// false if it ran out of memory
+bool makiHuffmanDecodeBegin(MakiHuffmanDecoder* decoder, const uint8_t* data,
+                            uint32_t size);
+// decodes about bytes more of the current round, true when it's done
+bool makiHuffmanDecodeStep(MakiHuffmanDecoder* decoder, uint32_t bytes);
+// frees everything, output included
+void makiHuffmanDecodeCancel(MakiHuffmanDecoder* decoder);
+
+#endif
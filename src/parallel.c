@@ -0,0 +1,217 @@
+#include "parallel.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef PARALLEL_HOST
+
+#include <pthread.h>
+#include <time.h>
+
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake = PTHREAD_COND_INITIALIZER;
+static uint32_t wakeCount = 0;
+
+static uint32_t lock(void) {
+	pthread_mutex_lock(&mutex);
+	return 0;
+}
+
+static void unlock(uint32_t saved) {
+	(void)saved;
+	pthread_mutex_unlock(&mutex);
+}
+
+static uint32_t nowUs(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec * 1000000 + time.tv_nsec / 1000;
+}
+
+#else
+
+#include "hardware/sync.h"
+#include "pico/multicore.h"
+#include "pico/stdlib.h"
+
+static spin_lock_t* spinLock;
+
+// also masks interrupts on the calling core, so hold it briefly
+static uint32_t lock(void) { return spin_lock_blocking(spinLock); }
+static void unlock(uint32_t saved) { spin_unlock(spinLock, saved); }
+
+static uint32_t nowUs(void) { return time_us_32(); }
+
+#endif
+
+static struct {
+	ParallelTask task;
+	void* context;
+	uint16_t next;
+	uint16_t count;
+	uint16_t chunk;
+	// chunks taken but not finished
+	uint8_t active;
+} job;
+
+// both cores take chunks until there are none left
+static void work(void) {
+	while (true) {
+		uint32_t saved = lock();
+		if (job.next >= job.count) {
+			unlock(saved);
+			return;
+		}
+
+		uint16_t start = job.next;
+		uint16_t end = start + job.chunk;
+		if (end > job.count) end = job.count;
+		job.next = end;
+		job.active++;
+
+		// can't change while a chunk is out
+		ParallelTask task = job.task;
+		void* context = job.context;
+		unlock(saved);
+
+		task(context, start, end);
+
+		saved = lock();
+		job.active--;
+		unlock(saved);
+	}
+}
+
+void parallelWork(void) { work(); }
+
+static bool jobDone(void) {
+	uint32_t saved = lock();
+	bool done = job.active == 0;
+	unlock(saved);
+	return done;
+}
+
+#ifdef PARALLEL_HOST
+
+static void* hostCore1(void* unused) {
+	(void)unused;
+	uint32_t seen = 0;
+	while (true) {
+		pthread_mutex_lock(&mutex);
+		while (wakeCount == seen) pthread_cond_wait(&wake, &mutex);
+		seen = wakeCount;
+		pthread_mutex_unlock(&mutex);
+
+		work();
+	}
+	return NULL;
+}
+
+void parallelInit(void) {
+	pthread_t thread;
+	pthread_create(&thread, NULL, hostCore1, NULL);
+}
+
+static void wakeCore1(void) {
+	pthread_mutex_lock(&mutex);
+	wakeCount++;
+	pthread_cond_signal(&wake);
+	pthread_mutex_unlock(&mutex);
+}
+
+#else
+
+void parallelInit(void) {
+	spinLock = spin_lock_init(spin_lock_claim_unused(true));
+}
+
+static void wakeCore1(void) {
+	// a full fifo means core1 is well behind, core0 will do it all
+	if (multicore_fifo_wready()) multicore_fifo_push_blocking(PARALLEL_JOB);
+}
+
+#endif
+
+void parallelFor(uint16_t count, ParallelTask task, void* context) {
+	if (count == 0) return;
+
+	uint32_t saved = lock();
+	job.task = task;
+	job.context = context;
+	job.next = 0;
+	job.count = count;
+	// small enough to even out, big enough that the lock doesn't matter
+	job.chunk = count / 16 > 0 ? count / 16 : 1;
+	job.active = 0;
+	unlock(saved);
+
+	wakeCore1();
+	work();
+
+	// core1 might still be on its last chunk
+	while (!jobDone()) {
+	}
+}
+
+void parallelBenchmark(ParallelBenchmark* result, uint16_t count,
+                       ParallelTask task, void* context, uint8_t repeats) {
+	result->singleUs = UINT32_MAX;
+	result->parallelUs = UINT32_MAX;
+
+	for (uint8_t i = 0; i < repeats; i++) {
+		uint32_t start = nowUs();
+		task(context, 0, count);
+		uint32_t single = nowUs() - start;
+		if (single < result->singleUs) result->singleUs = single;
+
+		start = nowUs();
+		parallelFor(count, task, context);
+		uint32_t parallel = nowUs() - start;
+		if (parallel < result->parallelUs) result->parallelUs = parallel;
+	}
+
+	result->efficiency =
+	    result->parallelUs == 0
+	        ? 100
+	        : (uint64_t)result->singleUs * 100 / (2 * result->parallelUs);
+}
+
+#ifdef PARALLEL_HOST_BENCHMARK
+
+#include <stdio.h>
+
+#include "rgb565.h"
+
+static uint16_t benchmarkBuffer[240 * 240];
+static uint8_t benchmarkGray[240 * 240];
+
+// a full screen effect pass, per row
+static void benchmarkRows(void* context, uint16_t start, uint16_t end) {
+	(void)context;
+	for (uint16_t y = start; y < end; y++) {
+		uint16_t* row = &benchmarkBuffer[y * 240];
+		for (uint8_t pass = 0; pass < 8; pass++) {
+			rgb565FromGray(row, &benchmarkGray[y * 240], 240);
+			rgb565Scale(row, 240, 128 + pass * 16);
+			rgb565BlendColor(row, 0xf81f, 240, 64);
+		}
+	}
+}
+
+int main() {
+	parallelInit();
+
+	for (uint32_t i = 0; i < sizeof(benchmarkGray); i++) {
+		benchmarkGray[i] = i * 7;
+	}
+
+	ParallelBenchmark result;
+	parallelBenchmark(&result, 240, benchmarkRows, NULL, 20);
+
+	printf("single %uus, parallel %uus, efficiency %u%%\n", result.singleUs,
+	       result.parallelUs, result.efficiency);
+
+	return 0;
+}
+
+#endif
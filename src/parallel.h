@@ -0,0 +1,42 @@
+#ifndef MAKI_PARALLEL_H
+#define MAKI_PARALLEL_H
+
+#include <stdint.h>
+
+// splits a loop between both cores. the range is handed out in chunks
+// from a shared counter, so when core1 is still busy sending a frame core0
+// just takes more of them and nothing waits on the flush
+//
+// on the rp2040 core1 joins through the pipeline's fifo loop, so call
+// pipelineInit first. built with PARALLEL_HOST the second core is a
+// pthread, for testing and benchmarking on a computer:
+//
+// gcc -O2 -DPARALLEL_HOST -DPARALLEL_HOST_BENCHMARK -Isrc src/parallel.c
+//     src/rgb565.c -lpthread
+
+// core1 fifo message, next to the pipeline's own
+#define PARALLEL_JOB 3
+
+// does start up to but not including end
+typedef void (*ParallelTask)(void* context, uint16_t start, uint16_t end);
+
+void parallelInit(void);
+
+// returns once all of count is done, by either core
+void parallelFor(uint16_t count, ParallelTask task, void* context);
+
+// core1's side, from the fifo loop
+void parallelWork(void);
+
+typedef struct {
+	uint32_t singleUs;
+	uint32_t parallelUs;
+	// single / (2 * parallel) in percent, 100 is perfect scaling
+	uint16_t efficiency;
+} ParallelBenchmark;
+
+// runs task over count on one core and then on both, best of repeats
+void parallelBenchmark(ParallelBenchmark* result, uint16_t count,
+                       ParallelTask task, void* context, uint8_t repeats);
+
+#endif
@@ -0,0 +1,117 @@
+#include "pipeline.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "parallel.h"
+#include "pico/multicore.h"
+#include "pico/stdlib.h"
+
+typedef struct {
+	uint16_t* buffer;
+	uint16_t x0, y0, x1, y1;
+} Flush;
+
+static struct {
+	Fade* fade;
+	uint16_t* buffers[2];
+	uint8_t current;
+	bool busy;
+	uint32_t submits;
+
+	// only touched by core1 between the fifo push and its reply
+	Flush flush;
+	volatile uint32_t flushedAt;
+} pipeline;
+
+#define PIPELINE_FLUSH 1
+#define PIPELINE_DONE 2
+
+static void core1Main(void) {
+	while (true) {
+		uint32_t message = multicore_fifo_pop_blocking();
+		if (message == PARALLEL_JOB) {
+			parallelWork();
+			continue;
+		}
+		if (message != PIPELINE_FLUSH) continue;
+
+		Flush* flush = &pipeline.flush;
+		fadeDisplayWindows(pipeline.fade, flush->x0, flush->y0, flush->x1,
+		                   flush->y1, flush->buffer);
+		pipeline.flushedAt = time_us_32();
+
+		__sync_synchronize();
+		multicore_fifo_push_blocking(PIPELINE_DONE);
+	}
+}
+
+void pipelineInit(Fade* fade, uint16_t* buffer, uint16_t* back) {
+	pipeline.fade = fade;
+	pipeline.buffers[0] = buffer;
+	pipeline.buffers[1] = back;
+	pipeline.current = 0;
+	pipeline.busy = false;
+	pipeline.submits = 0;
+
+	multicore_launch_core1(core1Main);
+}
+
+void pipelineWait(void) {
+	while (pipeline.busy) {
+		if (multicore_fifo_pop_blocking() == PIPELINE_DONE) {
+			pipeline.busy = false;
+		}
+	}
+}
+
+bool pipelineBusy(void) {
+	// done without blocking if the reply is already there
+	if (pipeline.busy && multicore_fifo_rvalid()) pipelineWait();
+	return pipeline.busy;
+}
+
+uint16_t* pipelineBuffer(void) {
+	if (pipeline.buffers[1] == NULL) pipelineWait();
+	return pipeline.buffers[pipeline.current];
+}
+
+uint32_t pipelineFlushedAt(void) { return pipeline.flushedAt; }
+
+uint32_t pipelineSubmits(void) { return pipeline.submits; }
+
+void pipelineSubmitWindow(uint16_t x0, uint16_t y0, uint16_t x1,
+                          uint16_t y1) {
+	if (x0 >= x1 || y0 >= y1) return;
+
+	uint16_t* buffer = pipeline.buffers[pipeline.current];
+
+	pipelineWait();
+
+	pipeline.flush = (Flush){buffer, x0, y0, x1, y1};
+	pipeline.busy = true;
+	pipeline.submits++;
+	__sync_synchronize();
+	multicore_fifo_push_blocking(PIPELINE_FLUSH);
+
+	if (pipeline.buffers[1] == NULL) return;
+
+	// core1 only reads, so the copy can run alongside it
+	pipeline.current ^= 1;
+	uint16_t* next = pipeline.buffers[pipeline.current];
+
+	if (x0 == 0 && x1 == PIPELINE_WIDTH) {
+		uint32_t offset = y0 * PIPELINE_WIDTH;
+		memcpy(&next[offset], &buffer[offset], (y1 - y0) * PIPELINE_WIDTH * 2);
+		return;
+	}
+
+	for (uint16_t y = y0; y < y1; y++) {
+		uint32_t offset = y * PIPELINE_WIDTH + x0;
+		memcpy(&next[offset], &buffer[offset], (x1 - x0) * 2);
+	}
+}
+
+void pipelineSubmit(void) {
+	pipelineSubmitWindow(0, 0, PIPELINE_WIDTH, PIPELINE_HEIGHT);
+}
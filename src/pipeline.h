@@ -0,0 +1,47 @@
+#ifndef MAKI_PIPELINE_H
+#define MAKI_PIPELINE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "fade.h"
+
+// core1 sends frames to the lcd while core0 gets on with the next one.
+// one flush is in flight at a time, handed over through the inter-core
+// fifo
+//
+// with one buffer, rendering waits for the flush to finish, but everything
+// else in the main loop runs alongside it. with two, core0 renders into
+// the other buffer straight away. the part just sent is copied across
+// first, so screens that only redraw what changed still see the last frame.
+// the copy is far quicker than the spi
+//
+// two buffers take another 115k, which only fits next to screens that
+// draw from flash. see PIPELINE_DOUBLE_BUFFER in CMakeLists.txt
+
+#define PIPELINE_WIDTH 240
+#define PIPELINE_HEIGHT 240
+
+// back can be NULL for one buffer. launches core1
+void pipelineInit(Fade* fade, uint16_t* buffer, uint16_t* back);
+
+// where to render next, waits for the flush when there's one buffer
+uint16_t* pipelineBuffer(void);
+
+// sends the render buffer, or part of it. end is exclusive like
+// LCD_1IN28_DisplayWindows
+void pipelineSubmit(void);
+void pipelineSubmitWindow(uint16_t x0, uint16_t y0, uint16_t x1,
+                          uint16_t y1);
+
+// until core1 is done, before anything else uses the lcd
+void pipelineWait(void);
+bool pipelineBusy(void);
+
+// time_us_32 when the last flush finished
+uint32_t pipelineFlushedAt(void);
+
+// counts every submit, to tell whether one happened since some point
+uint32_t pipelineSubmits(void);
+
+#endif
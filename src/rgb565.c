@@ -0,0 +1,210 @@
+#include "rgb565.h"
+
+#include <stdbool.h>
+
+// two pixels as one word, may alias the uint16_t buffers
+typedef uint32_t __attribute__((may_alias)) PixelPair;
+
+#if defined(__ARM_ARCH_6M__)
+// out of flash, a cache miss costs more than the whole loop body
+#define RGB565_KERNEL __attribute__((section(".time_critical.rgb565")))
+#else
+#define RGB565_KERNEL
+#endif
+
+#define ALWAYS_INLINE static inline __attribute__((always_inline))
+
+ALWAYS_INLINE uint32_t swapPair(uint32_t pair) {
+#if defined(__ARM_ARCH_6M__)
+	__asm__("rev16 %0, %1" : "=l"(pair) : "l"(pair));
+	return pair;
+#else
+	return ((pair & 0x00ff00ff) << 8) | ((pair >> 8) & 0x00ff00ff);
+#endif
+}
+
+ALWAYS_INLINE uint32_t toWeight(uint16_t alpha) {
+	if (alpha > 256) alpha = 256;
+	return (alpha + 4) >> 3;
+}
+
+// native rgb565 pairs split into two sets of fields with 5 bits of room
+// above each, so one multiply scales three fields at once:
+//
+// low:  blue 0, red 0 and green 1, masked with 0x07e0f81f
+// high: green 0, blue 1 and red 1, shifted down 5 and masked 0x07c0f83f
+//
+// a 0 to 32 weight lands the high set back where it started
+
+#define LOW_MASK 0x07e0f81f
+#define HIGH_MASK 0x07c0f83f
+#define HIGH_RESULT_MASK 0xf81f07e0
+
+ALWAYS_INLINE uint32_t blendPair(uint32_t a, uint32_t b, uint32_t weight) {
+	uint32_t inverse = 32 - weight;
+	uint32_t low =
+	    (((a & LOW_MASK) * inverse + (b & LOW_MASK) * weight) >> 5) & LOW_MASK;
+	uint32_t high = (((a >> 5) & HIGH_MASK) * inverse +
+	                 ((b >> 5) & HIGH_MASK) * weight) &
+	                HIGH_RESULT_MASK;
+	return low | high;
+}
+
+// blendPair with the b side already multiplied
+ALWAYS_INLINE uint32_t blendColorPair(uint32_t a, uint32_t inverse,
+                                      uint32_t low, uint32_t high) {
+	return ((((a & LOW_MASK) * inverse + low) >> 5) & LOW_MASK) |
+	       ((((a >> 5) & HIGH_MASK) * inverse + high) & HIGH_RESULT_MASK);
+}
+
+ALWAYS_INLINE uint32_t scalePair(uint32_t a, uint32_t weight) {
+	uint32_t low = (((a & LOW_MASK) * weight) >> 5) & LOW_MASK;
+	uint32_t high = (((a >> 5) & HIGH_MASK) * weight) & HIGH_RESULT_MASK;
+	return low | high;
+}
+
+ALWAYS_INLINE uint32_t grayPair(uint32_t gray) {
+	// both grays as 0x00gg00gg
+	return ((gray & 0x00f800f8) << 8) | ((gray & 0x00fc00fc) << 3) |
+	       ((gray >> 3) & 0x001f001f);
+}
+
+ALWAYS_INLINE uint32_t loadPair(const uint16_t* pixels, bool aligned) {
+	if (aligned) return *(const PixelPair*)pixels;
+	return pixels[0] | (uint32_t)pixels[1] << 16;
+}
+
+// the single pixel ends go through the pair math in the low half
+
+ALWAYS_INLINE void blendPairs(uint16_t* dst, const uint16_t* src,
+                              uint32_t count, uint32_t weight, bool aligned) {
+	PixelPair* out = (PixelPair*)dst;
+#pragma GCC unroll 2
+	for (; count >= 2; count -= 2, src += 2, out++) {
+		*out = swapPair(
+		    blendPair(swapPair(*out), swapPair(loadPair(src, aligned)), weight));
+	}
+	if (count > 0) {
+		dst = (uint16_t*)out;
+		*dst = swapPair(blendPair(swapPair(*dst), swapPair(*src), weight));
+	}
+}
+
+RGB565_KERNEL void rgb565Blend(uint16_t* dst, const uint16_t* src,
+                               uint32_t count, uint16_t alpha) {
+	uint32_t weight = toWeight(alpha);
+	if (count == 0) return;
+
+	if ((uintptr_t)dst & 2) {
+		*dst = swapPair(blendPair(swapPair(*dst), swapPair(*src), weight));
+		dst++, src++, count--;
+	}
+
+	// split so each loop is specialized
+	if ((uintptr_t)src & 2) {
+		blendPairs(dst, src, count, weight, false);
+	} else {
+		blendPairs(dst, src, count, weight, true);
+	}
+}
+
+RGB565_KERNEL void rgb565BlendColor(uint16_t* dst, uint16_t color,
+                                    uint32_t count, uint16_t alpha) {
+	uint32_t weight = toWeight(alpha);
+	uint32_t inverse = 32 - weight;
+
+	// the color side of blendPair, done once
+	uint32_t pair = swapPair(color | (uint32_t)color << 16);
+	uint32_t low = (pair & LOW_MASK) * weight;
+	uint32_t high = ((pair >> 5) & HIGH_MASK) * weight;
+
+	if (count == 0) return;
+
+	if ((uintptr_t)dst & 2) {
+		*dst = swapPair(blendColorPair(swapPair(*dst), inverse, low, high));
+		dst++, count--;
+	}
+
+	PixelPair* out = (PixelPair*)dst;
+#pragma GCC unroll 2
+	for (; count >= 2; count -= 2, out++) {
+		*out = swapPair(blendColorPair(swapPair(*out), inverse, low, high));
+	}
+
+	if (count > 0) {
+		dst = (uint16_t*)out;
+		*dst = swapPair(blendColorPair(swapPair(*dst), inverse, low, high));
+	}
+}
+
+RGB565_KERNEL void rgb565Scale(uint16_t* dst, uint32_t count,
+                               uint16_t brightness) {
+	uint32_t weight = toWeight(brightness);
+	if (weight == 32 || count == 0) return;
+
+	if ((uintptr_t)dst & 2) {
+		*dst = swapPair(scalePair(swapPair(*dst), weight));
+		dst++, count--;
+	}
+
+	PixelPair* out = (PixelPair*)dst;
+#pragma GCC unroll 2
+	for (; count >= 2; count -= 2, out++) {
+		*out = swapPair(scalePair(swapPair(*out), weight));
+	}
+
+	if (count > 0) {
+		dst = (uint16_t*)out;
+		*dst = swapPair(scalePair(swapPair(*dst), weight));
+	}
+}
+
+ALWAYS_INLINE void swapPairs(uint16_t* dst, const uint16_t* src,
+                             uint32_t count, bool aligned) {
+	PixelPair* out = (PixelPair*)dst;
+#pragma GCC unroll 4
+	for (; count >= 2; count -= 2, src += 2, out++) {
+		*out = swapPair(loadPair(src, aligned));
+	}
+	if (count > 0) {
+		dst = (uint16_t*)out;
+		*dst = swapPair(*src);
+	}
+}
+
+RGB565_KERNEL void rgb565Swap(uint16_t* dst, const uint16_t* src,
+                              uint32_t count) {
+	if (count == 0) return;
+
+	if ((uintptr_t)dst & 2) {
+		*dst = swapPair(*src);
+		dst++, src++, count--;
+	}
+
+	if ((uintptr_t)src & 2) {
+		swapPairs(dst, src, count, false);
+	} else {
+		swapPairs(dst, src, count, true);
+	}
+}
+
+RGB565_KERNEL void rgb565FromGray(uint16_t* dst, const uint8_t* gray,
+                                  uint32_t count) {
+	if (count == 0) return;
+
+	if ((uintptr_t)dst & 2) {
+		*dst = swapPair(grayPair(*gray));
+		dst++, gray++, count--;
+	}
+
+	PixelPair* out = (PixelPair*)dst;
+#pragma GCC unroll 2
+	for (; count >= 2; count -= 2, gray += 2, out++) {
+		*out = swapPair(grayPair(gray[0] | (uint32_t)gray[1] << 16));
+	}
+
+	if (count > 0) {
+		dst = (uint16_t*)out;
+		*dst = swapPair(grayPair(*gray));
+	}
+}
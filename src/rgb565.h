@@ -0,0 +1,47 @@
+#ifndef MAKI_RGB565_H
+#define MAKI_RGB565_H
+
+#include <stdint.h>
+
+// whole buffer pixel kernels, two pixels per 32 bit word. pixels are the
+// byte swapped rgb565 of the screen buffer. alpha and brightness are 0 to
+// 256, rounded to 5 bits
+//
+// plain c everywhere, on the rp2040 the byte swap is a rev16 and the
+// kernels run from ram. tests/rgb565_test.c checks them against per pixel
+// versions
+
+// src over dst, dst = dst + (src - dst) * alpha
+void rgb565Blend(uint16_t* dst, const uint16_t* src, uint32_t count,
+                 uint16_t alpha);
+
+// one color over dst, for tints and fades to a color
+void rgb565BlendColor(uint16_t* dst, uint16_t color, uint32_t count,
+                      uint16_t alpha);
+
+// towards black, 256 leaves it as is
+void rgb565Scale(uint16_t* dst, uint32_t count, uint16_t brightness);
+
+// flips each pixel between native and screen byte order. dst and src can
+// be the same, or src can be big endian image bytes like makiHuffmanDecode
+// output
+void rgb565Swap(uint16_t* dst, const uint16_t* src, uint32_t count);
+
+// 8 bit gray to screen pixels, truncating like getRaw
+void rgb565FromGray(uint16_t* dst, const uint8_t* gray, uint32_t count);
+
+// one pixel with its own weight, 0 to 32, for coverage and the like.
+// spread out as 0x07e0f81f so all channels blend in one multiply, which
+// matches the kernels exactly
+static inline uint16_t rgb565BlendPixel(uint16_t under, uint16_t over,
+                                        uint32_t weight) {
+	uint32_t a = (uint16_t)((under >> 8) | (under << 8));
+	uint32_t b = (uint16_t)((over >> 8) | (over << 8));
+	a = (a | a << 16) & 0x07e0f81f;
+	b = (b | b << 16) & 0x07e0f81f;
+	uint32_t spread = ((a * (32 - weight) + b * weight) >> 5) & 0x07e0f81f;
+	uint16_t color = spread | spread >> 16;
+	return (color >> 8) | (color << 8);
+}
+
+#endif
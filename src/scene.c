@@ -0,0 +1,394 @@
+#include "scene.h"
+
+#include <string.h>
+
+#include "GUI_Paint.h"
+#include "pipeline.h"
+
+static bool rectEmpty(SceneRect rect) {
+	return rect.x0 >= rect.x1 || rect.y0 >= rect.y1;
+}
+
+static SceneRect rectUnion(SceneRect a, SceneRect b) {
+	if (rectEmpty(a)) return b;
+	if (rectEmpty(b)) return a;
+	if (b.x0 < a.x0) a.x0 = b.x0;
+	if (b.y0 < a.y0) a.y0 = b.y0;
+	if (b.x1 > a.x1) a.x1 = b.x1;
+	if (b.y1 > a.y1) a.y1 = b.y1;
+	return a;
+}
+
+static SceneRect rectIntersect(SceneRect a, SceneRect b) {
+	if (b.x0 > a.x0) a.x0 = b.x0;
+	if (b.y0 > a.y0) a.y0 = b.y0;
+	if (b.x1 < a.x1) a.x1 = b.x1;
+	if (b.y1 < a.y1) a.y1 = b.y1;
+	return a;
+}
+
+static int32_t rectArea(SceneRect rect) {
+	return rectEmpty(rect) ? 0 : (int32_t)(rect.x1 - rect.x0) * (rect.y1 - rect.y0);
+}
+
+// tree
+
+static void nodeInit(Node* node, NodeType type, int16_t x, int16_t y,
+                     uint16_t width, uint16_t height, uint16_t color) {
+	memset(node, 0, sizeof(Node));
+	node->type = type;
+	node->x = x;
+	node->y = y;
+	node->width = width;
+	node->height = height;
+	node->color = color;
+	node->visible = true;
+}
+
+void sceneInit(Scene* scene, uint16_t background) {
+	nodeInitGroup(&scene->root, 0, 0);
+	scene->root.scene = scene;
+	scene->background = background;
+	scene->damageCount = 0;
+	sceneDamage(scene, (SceneRect){0, 0, SCENE_WIDTH, SCENE_HEIGHT});
+}
+
+static void nodeOrigin(Node* node, int16_t* x, int16_t* y) {
+	*x = 0;
+	*y = 0;
+	for (Node* parent = node->parent; parent != NULL; parent = parent->parent) {
+		*x += parent->x;
+		*y += parent->y;
+	}
+}
+
+// screen area the node and its children cover
+static SceneRect nodeBoundsAt(Node* node, int16_t originX, int16_t originY) {
+	SceneRect bounds = {0, 0, 0, 0};
+	if (!node->visible) return bounds;
+
+	int16_t x = originX + node->x;
+	int16_t y = originY + node->y;
+
+	if (node->type == NODE_GROUP) {
+		for (Node* child = node->firstChild; child != NULL;
+		     child = child->nextSibling) {
+			bounds = rectUnion(bounds, nodeBoundsAt(child, x, y));
+		}
+		return bounds;
+	}
+
+	return (SceneRect){x, y, x + node->width, y + node->height};
+}
+
+static void nodeDamage(Node* node) {
+	if (node->scene == NULL) return;
+	int16_t x, y;
+	nodeOrigin(node, &x, &y);
+	sceneDamage(node->scene, nodeBoundsAt(node, x, y));
+}
+
+static void nodeSetScene(Node* node, Scene* scene) {
+	node->scene = scene;
+	for (Node* child = node->firstChild; child != NULL;
+	     child = child->nextSibling) {
+		nodeSetScene(child, scene);
+	}
+}
+
+void sceneAdd(Scene* scene, Node* parent, Node* node) {
+	if (parent == NULL) parent = &scene->root;
+
+	node->parent = parent;
+	node->nextSibling = NULL;
+
+	// appended, so later nodes draw on top
+	Node** next = &parent->firstChild;
+	while (*next != NULL) next = &(*next)->nextSibling;
+	*next = node;
+
+	nodeSetScene(node, scene);
+	nodeDamage(node);
+}
+
+void sceneRemove(Node* node) {
+	if (node->parent == NULL) return;
+	nodeDamage(node);
+
+	Node** next = &node->parent->firstChild;
+	while (*next != node) next = &(*next)->nextSibling;
+	*next = node->nextSibling;
+
+	node->parent = NULL;
+	node->nextSibling = NULL;
+	nodeSetScene(node, NULL);
+}
+
+void sceneDamage(Scene* scene, SceneRect rect) {
+	rect = rectIntersect(rect, (SceneRect){0, 0, SCENE_WIDTH, SCENE_HEIGHT});
+	if (rectEmpty(rect)) return;
+
+	// fold in anything it overlaps, which can make it overlap more
+
+	for (uint8_t i = 0; i < scene->damageCount;) {
+		if (rectEmpty(rectIntersect(rect, scene->damage[i]))) {
+			i++;
+			continue;
+		}
+		rect = rectUnion(rect, scene->damage[i]);
+		scene->damage[i] = scene->damage[--scene->damageCount];
+		i = 0;
+	}
+
+	if (scene->damageCount < SCENE_MAX_DAMAGE) {
+		scene->damage[scene->damageCount++] = rect;
+		return;
+	}
+
+	// out of slots, grow whichever rect grows the least
+
+	uint8_t best = 0;
+	int32_t bestGrowth = INT32_MAX;
+	for (uint8_t i = 0; i < scene->damageCount; i++) {
+		int32_t growth = rectArea(rectUnion(scene->damage[i], rect)) -
+		                 rectArea(scene->damage[i]);
+		if (growth < bestGrowth) {
+			bestGrowth = growth;
+			best = i;
+		}
+	}
+
+	SceneRect merged = rectUnion(scene->damage[best], rect);
+	scene->damage[best] = scene->damage[--scene->damageCount];
+	sceneDamage(scene, merged);
+}
+
+// setters damage where the node was, change, then where it is now
+
+void nodeInitGroup(Node* node, int16_t x, int16_t y) {
+	nodeInit(node, NODE_GROUP, x, y, 0, 0, 0);
+}
+
+void nodeInitRect(Node* node, int16_t x, int16_t y, uint16_t width,
+                  uint16_t height, uint16_t color) {
+	nodeInit(node, NODE_RECT, x, y, width, height, color);
+}
+
+void nodeInitArc(Node* node, int16_t x, int16_t y, uint16_t diameter,
+                 uint16_t thickness, int16_t startAngle, int16_t endAngle,
+                 uint16_t color) {
+	nodeInit(node, NODE_ARC, x, y, diameter, diameter, color);
+	node->arc.thickness = thickness;
+	node->arc.startAngle = startAngle;
+	node->arc.endAngle = endAngle;
+}
+
+void nodeInitText(Node* node, int16_t x, int16_t y, const char* text,
+                  sFONT* font, uint16_t color) {
+	nodeInit(node, NODE_TEXT, x, y, strlen(text) * font->Width, font->Height,
+	         color);
+	node->text.text = text;
+	node->text.font = font;
+}
+
+void nodeInitImage(Node* node, int16_t x, int16_t y, uint16_t width,
+                   uint16_t height, const uint16_t* pixels) {
+	nodeInit(node, NODE_IMAGE, x, y, width, height, 0);
+	node->image.pixels = pixels;
+}
+
+void nodeSetPosition(Node* node, int16_t x, int16_t y) {
+	if (node->x == x && node->y == y) return;
+	nodeDamage(node);
+	node->x = x;
+	node->y = y;
+	nodeDamage(node);
+}
+
+void nodeSetSize(Node* node, uint16_t width, uint16_t height) {
+	if (node->width == width && node->height == height) return;
+	nodeDamage(node);
+	node->width = width;
+	node->height = height;
+	nodeDamage(node);
+}
+
+void nodeSetVisible(Node* node, bool visible) {
+	if (node->visible == visible) return;
+	nodeDamage(node);
+	node->visible = visible;
+	nodeDamage(node);
+}
+
+void nodeSetColor(Node* node, uint16_t color) {
+	if (node->color == color) return;
+	node->color = color;
+	nodeDamage(node);
+}
+
+void nodeSetArcAngles(Node* node, int16_t startAngle, int16_t endAngle) {
+	if (node->arc.startAngle == startAngle && node->arc.endAngle == endAngle) {
+		return;
+	}
+	node->arc.startAngle = startAngle;
+	node->arc.endAngle = endAngle;
+	nodeDamage(node);
+}
+
+void nodeSetText(Node* node, const char* text) {
+	nodeDamage(node);
+	node->text.text = text;
+	node->width = strlen(text) * node->text.font->Width;
+	nodeDamage(node);
+}
+
+void nodeSetImage(Node* node, const uint16_t* pixels) {
+	node->image.pixels = pixels;
+	nodeDamage(node);
+}
+
+// rasterizers, everything is clipped to the damage rect being redrawn
+
+static void drawRect(uint16_t* buffer, SceneRect clip, uint16_t color) {
+	for (int16_t y = clip.y0; y < clip.y1; y++) {
+		uint16_t* row = &buffer[y * SCENE_WIDTH];
+		for (int16_t x = clip.x0; x < clip.x1; x++) {
+			row[x] = color;
+		}
+	}
+}
+
+static void drawImage(Node* node, uint16_t* buffer, SceneRect bounds,
+                      SceneRect clip) {
+	for (int16_t y = clip.y0; y < clip.y1; y++) {
+		memcpy(&buffer[y * SCENE_WIDTH + clip.x0],
+		       &node->image.pixels[(y - bounds.y0) * node->width + clip.x0 -
+		                           bounds.x0],
+		       (clip.x1 - clip.x0) * 2);
+	}
+}
+
+static void drawText(Node* node, uint16_t* buffer, SceneRect bounds,
+                     SceneRect clip) {
+	sFONT* font = node->text.font;
+	uint16_t widthBytes = (font->Width + 7) / 8;
+
+	int16_t first = (clip.x0 - bounds.x0) / font->Width;
+	int16_t last = (clip.x1 - 1 - bounds.x0) / font->Width;
+
+	for (int16_t i = first; i <= last; i++) {
+		const uint8_t* glyph = Font_GetGlyph(font, node->text.text[i]);
+		if (glyph == NULL) continue;
+
+		int16_t charX = bounds.x0 + i * font->Width;
+		int16_t x0 = charX > clip.x0 ? charX : clip.x0;
+		int16_t x1 = charX + font->Width < clip.x1 ? charX + font->Width
+		                                           : clip.x1;
+
+		for (int16_t y = clip.y0; y < clip.y1; y++) {
+			const uint8_t* row = &glyph[(y - bounds.y0) * widthBytes];
+			for (int16_t x = x0; x < x1; x++) {
+				uint16_t column = x - charX;
+				if (row[column / 8] & (0x80 >> (column % 8))) {
+					buffer[y * SCENE_WIDTH + x] = node->color;
+				}
+			}
+		}
+	}
+}
+
+static void drawArc(Node* node, uint16_t* buffer, SceneRect bounds,
+                    SceneRect clip) {
+	// everything in half pixels so the center can sit between pixels
+	int32_t centerX = bounds.x0 * 2 + node->width;
+	int32_t centerY = bounds.y0 * 2 + node->height;
+	int32_t outer = node->width;
+	int32_t inner = node->width - node->arc.thickness * 2;
+	if (inner < 0) inner = 0;
+
+	int16_t sweep = node->arc.endAngle - node->arc.startAngle;
+	bool full = sweep >= ANGLE_FULL_TURN || sweep <= -ANGLE_FULL_TURN;
+	sweep &= ANGLE_FULL_TURN - 1;
+	// otherwise pixels right on the edge pass both tests below
+	if (sweep == 0 && !full) return;
+
+	// edge directions in Q8, 12 o'clock is up and y points down
+	int32_t startX = Paint_Sin(node->arc.startAngle) >> 8;
+	int32_t startY = -Paint_Cos(node->arc.startAngle) >> 8;
+	int32_t endX = Paint_Sin(node->arc.endAngle) >> 8;
+	int32_t endY = -Paint_Cos(node->arc.endAngle) >> 8;
+
+	for (int16_t y = clip.y0; y < clip.y1; y++) {
+		int32_t dy = y * 2 + 1 - centerY;
+		for (int16_t x = clip.x0; x < clip.x1; x++) {
+			int32_t dx = x * 2 + 1 - centerX;
+			int32_t distance = dx * dx + dy * dy;
+			if (distance > outer * outer || distance < inner * inner) continue;
+
+			if (!full) {
+				// positive cross product means clockwise of the edge
+				bool afterStart = startX * dy - startY * dx >= 0;
+				bool beforeEnd = dx * endY - dy * endX >= 0;
+				bool inside = sweep <= ANGLE_FULL_TURN / 2
+				                  ? afterStart && beforeEnd
+				                  : afterStart || beforeEnd;
+				if (!inside) continue;
+			}
+
+			buffer[y * SCENE_WIDTH + x] = node->color;
+		}
+	}
+}
+
+static void drawNode(Node* node, uint16_t* buffer, SceneRect clip,
+                     int16_t originX, int16_t originY) {
+	if (!node->visible) return;
+
+	int16_t x = originX + node->x;
+	int16_t y = originY + node->y;
+
+	if (node->type == NODE_GROUP) {
+		for (Node* child = node->firstChild; child != NULL;
+		     child = child->nextSibling) {
+			drawNode(child, buffer, clip, x, y);
+		}
+		return;
+	}
+
+	SceneRect bounds = {x, y, x + node->width, y + node->height};
+	SceneRect area = rectIntersect(bounds, clip);
+	if (rectEmpty(area)) return;
+
+	switch (node->type) {
+		case NODE_RECT:
+			drawRect(buffer, area, node->color);
+			break;
+		case NODE_ARC:
+			drawArc(node, buffer, bounds, area);
+			break;
+		case NODE_TEXT:
+			drawText(node, buffer, bounds, area);
+			break;
+		case NODE_IMAGE:
+			drawImage(node, buffer, bounds, area);
+			break;
+		default:
+			break;
+	}
+}
+
+bool sceneRender(Scene* scene, uint16_t* buffer) {
+	if (scene->damageCount == 0) return false;
+
+	for (uint8_t i = 0; i < scene->damageCount; i++) {
+		SceneRect rect = scene->damage[i];
+		// double buffered, each send swaps to the other buffer
+		if (i > 0) buffer = pipelineBuffer();
+		drawRect(buffer, rect, scene->background);
+		drawNode(&scene->root, buffer, rect, 0, 0);
+		pipelineSubmitWindow(rect.x0, rect.y0, rect.x1, rect.y1);
+	}
+
+	scene->damageCount = 0;
+	return true;
+}
@@ -0,0 +1,106 @@
+#ifndef MAKI_SCENE_H
+#define MAKI_SCENE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "fonts.h"
+
+// retained display list. setters remember what area changed, and
+// sceneRender only redraws and sends those areas through the pipeline
+
+#define SCENE_WIDTH 240
+#define SCENE_HEIGHT 240
+#define SCENE_MAX_DAMAGE 4
+
+// end is exclusive, same as LCD_1IN28_DisplayWindows
+typedef struct {
+	int16_t x0;
+	int16_t y0;
+	int16_t x1;
+	int16_t y1;
+} SceneRect;
+
+typedef enum {
+	NODE_GROUP,
+	NODE_RECT,
+	NODE_ARC,
+	NODE_TEXT,
+	NODE_IMAGE,
+} NodeType;
+
+struct Scene;
+
+typedef struct Node {
+	NodeType type;
+	struct Scene* scene;
+	struct Node* parent;
+	struct Node* firstChild;
+	struct Node* nextSibling;
+
+	// relative to the parent. arcs are centered in their box
+	int16_t x;
+	int16_t y;
+	uint16_t width;
+	uint16_t height;
+	bool visible;
+
+	// same byte swapped rgb565 as the screen buffer
+	uint16_t color;
+
+	union {
+		struct {
+			uint16_t thickness;
+			// clockwise from 12 o'clock, ANGLE_FULL_TURN per turn
+			int16_t startAngle;
+			int16_t endAngle;
+		} arc;
+		struct {
+			const char* text;
+			sFONT* font;
+		} text;
+		struct {
+			const uint16_t* pixels;
+		} image;
+	};
+} Node;
+
+typedef struct Scene {
+	Node root;
+	uint16_t background;
+
+	SceneRect damage[SCENE_MAX_DAMAGE];
+	uint8_t damageCount;
+} Scene;
+
+void sceneInit(Scene* scene, uint16_t background);
+void sceneAdd(Scene* scene, Node* parent, Node* node);
+void sceneRemove(Node* node);
+void sceneDamage(Scene* scene, SceneRect rect);
+
+// buffer must be pipelineBuffer(), each damaged area is sent through the
+// pipeline as soon as it's drawn. true when anything was sent, there's
+// nothing left to submit
+bool sceneRender(Scene* scene, uint16_t* buffer);
+
+void nodeInitGroup(Node* node, int16_t x, int16_t y);
+void nodeInitRect(Node* node, int16_t x, int16_t y, uint16_t width,
+                  uint16_t height, uint16_t color);
+void nodeInitArc(Node* node, int16_t x, int16_t y, uint16_t diameter,
+                 uint16_t thickness, int16_t startAngle, int16_t endAngle,
+                 uint16_t color);
+void nodeInitText(Node* node, int16_t x, int16_t y, const char* text,
+                  sFONT* font, uint16_t color);
+void nodeInitImage(Node* node, int16_t x, int16_t y, uint16_t width,
+                   uint16_t height, const uint16_t* pixels);
+
+void nodeSetPosition(Node* node, int16_t x, int16_t y);
+void nodeSetSize(Node* node, uint16_t width, uint16_t height);
+void nodeSetVisible(Node* node, bool visible);
+void nodeSetColor(Node* node, uint16_t color);
+void nodeSetArcAngles(Node* node, int16_t startAngle, int16_t endAngle);
+// text isn't copied, call again after changing it in place
+void nodeSetText(Node* node, const char* text);
+void nodeSetImage(Node* node, const uint16_t* pixels);
+
+#endif
@@ -0,0 +1,60 @@
+#include "scheduler.h"
+
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+
+void schedulerInit(Scheduler* scheduler, uint8_t fps) {
+	scheduler->interval = 0;
+	schedulerSetFps(scheduler, fps);
+
+	scheduler->deadline = time_us_64() + scheduler->interval;
+	scheduler->frames = 0;
+	scheduler->dropped = 0;
+	scheduler->woken = false;
+}
+
+void schedulerSetFps(Scheduler* scheduler, uint8_t fps) {
+	if (fps == 0) fps = SCHEDULER_DEFAULT_FPS;
+	uint32_t interval = 1000000 / fps;
+	if (interval == scheduler->interval) return;
+
+	// a faster rate shouldn't wait out the rest of a slow frame
+	if (scheduler->interval != 0 && interval < scheduler->interval) {
+		uint64_t soonest = time_us_64() + interval;
+		if (scheduler->deadline > soonest) scheduler->deadline = soonest;
+	}
+
+	scheduler->interval = interval;
+}
+
+bool schedulerWait(Scheduler* scheduler) {
+	absolute_time_t deadline = from_us_since_boot(scheduler->deadline);
+
+	// any interrupt or core1 fifo push wakes the wfe, then check again
+	while (!scheduler->woken && !time_reached(deadline)) {
+		best_effort_wfe_or_timeout(deadline);
+	}
+
+	bool woken = scheduler->woken;
+	scheduler->woken = false;
+
+	uint64_t now = time_us_64();
+	if (now < scheduler->deadline) return woken;
+
+	scheduler->frames++;
+	uint32_t missed = (now - scheduler->deadline) / scheduler->interval;
+	scheduler->dropped += missed;
+	scheduler->deadline += (uint64_t)(missed + 1) * scheduler->interval;
+
+	return false;
+}
+
+void schedulerWake(Scheduler* scheduler) {
+	scheduler->woken = true;
+	// in case core0 is in wfe without an interrupt to wake it
+	__sev();
+}
+
+bool schedulerIdle(Scheduler* scheduler) {
+	return !scheduler->woken && time_us_64() < scheduler->deadline;
+}
@@ -0,0 +1,42 @@
+#ifndef MAKI_SCHEDULER_H
+#define MAKI_SCHEDULER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// paces the main loop at a target frame rate and sleeps between frames
+// instead of spinning. input wakes it early so touches don't wait for the
+// next frame, without moving the deadline, so the rate doesn't drift
+//
+// a frame that starts after its deadline counts the ones it skipped as
+// dropped, then lines up again from there rather than rushing to catch up
+
+#define SCHEDULER_DEFAULT_FPS 30
+
+typedef struct {
+	uint32_t interval;  // us per frame
+	uint64_t deadline;  // us since boot
+
+	uint32_t frames;
+	uint32_t dropped;
+
+	// set from interrupts
+	volatile bool woken;
+} Scheduler;
+
+void schedulerInit(Scheduler* scheduler, uint8_t fps);
+// keeps the current deadline
+void schedulerSetFps(Scheduler* scheduler, uint8_t fps);
+
+// sleeps until the next frame is due or schedulerWake. true when woken
+// before the frame is due, which keeps the deadline and isn't a frame
+bool schedulerWait(Scheduler* scheduler);
+
+// safe from interrupts
+void schedulerWake(Scheduler* scheduler);
+
+// before the next frame is due and nothing has woken it, for work that
+// can be done in slices
+bool schedulerIdle(Scheduler* scheduler);
+
+#endif
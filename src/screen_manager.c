@@ -0,0 +1,93 @@
+#include "screen_manager.h"
+
+#include <stddef.h>
+
+void screenManagerInit(ScreenManager* manager) {
+	manager->count = 0;
+	manager->current = -1;
+	manager->next = 0;
+	manager->redraw = false;
+}
+
+bool screenManagerAdd(ScreenManager* manager, Screen* screen) {
+	if (manager->count >= SCREEN_MANAGER_MAX_SCREENS) return false;
+
+	if (screen->init != NULL) screen->init(screen->state);
+
+	manager->screens[manager->count++] = screen;
+	return true;
+}
+
+void screenManagerDeinit(ScreenManager* manager) {
+	if (manager->current >= 0) {
+		Screen* screen = manager->screens[manager->current];
+		if (screen->leave != NULL) screen->leave(screen->state);
+		manager->current = -1;
+	}
+
+	for (uint8_t i = 0; i < manager->count; i++) {
+		Screen* screen = manager->screens[i];
+		if (screen->deinit != NULL) screen->deinit(screen->state);
+	}
+	manager->count = 0;
+}
+
+void screenManagerShow(ScreenManager* manager, uint8_t index) {
+	if (index < manager->count) manager->next = index;
+}
+
+void screenManagerNext(ScreenManager* manager) {
+	// from next rather than current so quick presses don't get lost
+	int8_t next = manager->next + 1;
+	manager->next = next >= manager->count ? 0 : next;
+}
+
+void screenManagerPrevious(ScreenManager* manager) {
+	int8_t previous = manager->next - 1;
+	manager->next = previous < 0 ? manager->count - 1 : previous;
+}
+
+uint8_t screenManagerFps(ScreenManager* manager) {
+	if (manager->count == 0) return 0;
+	return manager->screens[manager->next]->fps;
+}
+
+bool screenManagerPending(ScreenManager* manager) {
+	return manager->count > 0 && manager->next != manager->current;
+}
+
+bool screenManagerSwitch(ScreenManager* manager) {
+	if (manager->count == 0) return false;
+
+	int8_t next = manager->next;
+	if (next == manager->current) return false;
+
+	if (manager->current >= 0) {
+		Screen* old = manager->screens[manager->current];
+		if (old->leave != NULL) old->leave(old->state);
+	}
+
+	Screen* screen = manager->screens[next];
+	if (screen->enter != NULL) screen->enter(screen->state);
+
+	manager->current = next;
+	manager->redraw = true;
+
+	// long press goes forward, so that's the likely one
+	Screen* following = manager->screens[(next + 1) % manager->count];
+	if (following->prefetch != NULL) following->prefetch(following->state);
+
+	return true;
+}
+
+bool screenManagerRender(ScreenManager* manager, uint16_t* buffer) {
+	if (manager->count == 0) return false;
+
+	screenManagerSwitch(manager);
+
+	bool redraw = manager->redraw;
+	manager->redraw = false;
+
+	Screen* screen = manager->screens[manager->current];
+	return screen->render(screen->state, buffer, redraw);
+}
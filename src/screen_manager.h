@@ -0,0 +1,75 @@
+#ifndef MAKI_SCREEN_MANAGER_H
+#define MAKI_SCREEN_MANAGER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// registry of screens and their lifecycle. big assets come from the asset
+// cache, pinned while their screen is shown, and the next screen gets a
+// chance to prefetch its own
+//
+// init     once when added, small setup only
+// enter    every time it's shown, fetch and pin assets
+// render   same as the old XScreen functions, true when the buffer changed
+// leave    every time it stops being shown, unpin assets
+// prefetch when it's likely next, queue its assets with assetCachePrefetch
+// deinit   once on screenManagerDeinit
+//
+// hooks can be NULL except render
+//
+// fps is how often render is called while shown, 0 for the scheduler's
+// default. screens that only change on input can go very low, switching
+// wakes the loop straight away
+
+#define SCREEN_MANAGER_MAX_SCREENS 8
+
+typedef struct {
+	const char* name;
+	void* state;
+	uint8_t fps;
+
+	void (*init)(void* state);
+	void (*enter)(void* state);
+	bool (*render)(void* state, uint16_t* buffer, bool redraw);
+	void (*leave)(void* state);
+	void (*prefetch)(void* state);
+	void (*deinit)(void* state);
+} Screen;
+
+typedef struct {
+	Screen* screens[SCREEN_MANAGER_MAX_SCREENS];
+	uint8_t count;
+
+	int8_t current;  // -1 before the first render
+	// set from interrupts, picked up by the next render
+	volatile int8_t next;
+	// the next render draws everything
+	bool redraw;
+} ScreenManager;
+
+void screenManagerInit(ScreenManager* manager);
+bool screenManagerAdd(ScreenManager* manager, Screen* screen);
+// leaves the current screen and deinits them all
+void screenManagerDeinit(ScreenManager* manager);
+
+// safe from interrupts, only takes effect on the next render
+void screenManagerShow(ScreenManager* manager, uint8_t index);
+void screenManagerNext(ScreenManager* manager);
+void screenManagerPrevious(ScreenManager* manager);
+
+// of the current screen, or the one about to be shown
+uint8_t screenManagerFps(ScreenManager* manager);
+
+// a switch is waiting for the next render
+bool screenManagerPending(ScreenManager* manager);
+
+// leaves and enters if asked to, true when it did. render does this
+// itself, calling it first is for anything that has to happen in between,
+// like a transition taking a copy once the old screen's assets are free
+bool screenManagerSwitch(ScreenManager* manager);
+
+// switches if asked to, then renders the current screen. true when the
+// buffer needs sending
+bool screenManagerRender(ScreenManager* manager, uint16_t* buffer);
+
+#endif
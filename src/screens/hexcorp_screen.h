@@ -3,34 +3,20 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
-#include "../color.h"
-#include "../images/hexcorp_image.h"
-#include "../maki_huffman_decode.h"
+#include "../images/hexcorp_vector.h"
+#include "../vector.h"
 
-typedef struct {
-	uint8_t* image;
-	Color hexCorpColor;
-	Color blackColor;
-} HexCorpScreenState;
-
-void InitHexCorpScreenState(HexCorpScreenState* state) {
-	uint32_t size = sizeof(hexcorp_image);
-	state->image = makiHuffmanDecode(hexcorp_image, &size);
-
-	state->hexCorpColor = hexColor(0xff, 0x66, 0xff);
-	state->blackColor = hexColor(0x00, 0x00, 0x00);
-}
-
-// TODO: free image for deinit
-
-bool HexCorpScreen(HexCorpScreenState* state, uint16_t* buffer, bool redraw) {
+bool HexCorpScreen(uint16_t* buffer, bool redraw) {
 	if (redraw) {
-		for (uint16_t i = 0; i < 240 * 240; i++) {
-			Color color = lerpColor(state->blackColor, state->hexCorpColor,
-			                        (float)state->image[i] / 0xff);
-			buffer[i] = color.raw;
-		}
+		memset(buffer, 0, 240 * 240 * 2);
+
+		VectorTransform transform;
+		// the view is 2000 wide
+		vectorTransformInit(&transform, hexcorp_vector, 0, 65536 * 240 / 2000,
+		                    120, 120);
+		vectorDraw(buffer, hexcorp_vector, &transform);
 
 		return true;
 	}
@@ -38,4 +24,10 @@ bool HexCorpScreen(HexCorpScreenState* state, uint16_t* buffer, bool redraw) {
 	return false;
 }
 
+// screen manager hooks, the outline is a few hundred bytes of flash
+
+bool HexCorpScreenRender(void* state, uint16_t* buffer, bool redraw) {
+	return HexCorpScreen(buffer, redraw);
+}
+
 #endif
\ No newline at end of file
@@ -3,33 +3,167 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
-#include "../images/maki_image.h"
-#include "../maki_huffman_decode.h"
+#include "../assets.h"
+#include "../color.h"
+#include "../compositor.h"
+#include "../images/font24_maki_sdf.h"
+#include "../pipeline.h"
+#include "../sdf.h"
+#include "hardware/adc.h"
+#include "pico/stdlib.h"
+
+#define MAKI_BATTERY_WIDTH 24
+#define MAKI_BATTERY_HEIGHT 12
+#define MAKI_BATTERY_FILL 17
+#define MAKI_BATTERY_CHECK_MS 5000
+// font24 is 17 field pixels a glyph, "maki" at 2.5x is 170 wide. only
+// those four glyphs are in the field, 3,200 bytes
+#define MAKI_NAME_ZOOM (65536 * 5 / 2)
 
 typedef struct {
 	uint8_t* image;
+
+	Compositor compositor;
+
+	Layer batteryLayer;
+	uint16_t batteryPixels[MAKI_BATTERY_WIDTH * MAKI_BATTERY_HEIGHT];
+	uint8_t batteryAlpha[(MAKI_BATTERY_WIDTH + 7) / 8 * MAKI_BATTERY_HEIGHT];
+	uint8_t batteryLevel;
+	uint32_t lastBatteryCheck;
 } MakiProfilePictureScreenState;
 
-void InitMakiProfilePictureScreenState(MakiProfilePictureScreenState* state) {
-	uint32_t size = sizeof(maki_image);
-	state->image = makiHuffmanDecode(maki_image, &size);
+uint8_t MakiProfilePictureBatteryLevel() {
+	// half the battery voltage through a 3.3v 12 bit adc, lipo is
+	// roughly 3.3v empty to 4.2v full
+	int32_t millivolts = (int32_t)adc_read() * 3300 * 2 / (1 << 12);
+	int32_t level = (millivolts - 3300) * MAKI_BATTERY_FILL / 900;
+	if (level < 0) return 0;
+	if (level > MAKI_BATTERY_FILL) return MAKI_BATTERY_FILL;
+	return level;
 }
 
-// TODO: free image for deinit
+void MakiProfilePictureDrawBattery(MakiProfilePictureScreenState* state) {
+	uint16_t white = getRaw(0xff, 0xff, 0xff);
+	uint16_t fill = state->batteryLevel > MAKI_BATTERY_FILL / 5
+	                    ? getRaw(0x66, 0xff, 0x66)
+	                    : getRaw(0xff, 0x44, 0x44);
+
+	memset(state->batteryAlpha, 0, sizeof(state->batteryAlpha));
+
+	for (uint8_t y = 0; y < MAKI_BATTERY_HEIGHT; y++) {
+		for (uint8_t x = 0; x < MAKI_BATTERY_WIDTH; x++) {
+			bool body = x < 21;
+			bool outline = body && (x == 0 || x == 20 || y == 0 ||
+			                        y == MAKI_BATTERY_HEIGHT - 1);
+			bool nub = x >= 21 && y >= 4 && y < 8;
+			bool filled = x >= 2 && x < 2 + state->batteryLevel && y >= 2 &&
+			              y < MAKI_BATTERY_HEIGHT - 2;
+
+			uint16_t i = y * MAKI_BATTERY_WIDTH + x;
+			state->batteryPixels[i] = filled ? fill : white;
+
+			if (outline || nub || filled) {
+				state->batteryAlpha[y * ((MAKI_BATTERY_WIDTH + 7) / 8) +
+				                    x / 8] |= 0x80 >> (x % 8);
+			}
+		}
+	}
+
+	layerMarkDirty(&state->batteryLayer);
+}
+
+void InitMakiProfilePictureScreenState(MakiProfilePictureScreenState* state) {
+	// from the asset cache while shown, black without it
+	state->image = NULL;
+
+	compositorInit(&state->compositor, NULL, 0x0000);
+
+	// top middle, inside the round display
+	layerInit(&state->batteryLayer, (240 - MAKI_BATTERY_WIDTH) / 2, 16,
+	          MAKI_BATTERY_WIDTH, MAKI_BATTERY_HEIGHT, state->batteryPixels,
+	          state->batteryAlpha, ALPHA_1BIT);
+	compositorAddLayer(&state->compositor, &state->batteryLayer);
+
+	state->batteryLevel = MakiProfilePictureBatteryLevel();
+	state->lastBatteryCheck = to_ms_since_boot(get_absolute_time());
+	MakiProfilePictureDrawBattery(state);
+}
 
 bool MakiProfilePictureScreen(MakiProfilePictureScreenState* state,
                               uint16_t* buffer, bool redraw) {
+	uint32_t now = to_ms_since_boot(get_absolute_time());
+	if (now - state->lastBatteryCheck > MAKI_BATTERY_CHECK_MS) {
+		state->lastBatteryCheck = now;
+
+		uint8_t level = MakiProfilePictureBatteryLevel();
+		if (level != state->batteryLevel) {
+			state->batteryLevel = level;
+			MakiProfilePictureDrawBattery(state);
+		}
+	}
+
 	if (redraw) {
-		for (uint16_t i = 0; i < 240 * 240; i++) {
-			buffer[i] = ((uint16_t)state->image[i * 2] << 8) |
-			            ((uint16_t)state->image[i * 2 + 1]);
+		compositorMarkAllDirty(&state->compositor);
+		compositorRender(&state->compositor, buffer, NULL);
+
+		// out of ram for the picture, the name from flash instead. the
+		// battery is above it, so its updates never touch these rows
+		if (state->image == NULL) {
+			SdfStyle style = {
+			    .color = getRaw(0xff, 0xff, 0xff),
+			    .glowColor = getRaw(0xff, 0x66, 0xff),
+			    .glowWidth = 6 * 256,
+			};
+			// centered on the ink, the field has spread pixels of padding
+			const SdfField* font = &font24_maki_sdf;
+			int16_t x = 120 - (((font->spread * 2 + font->advance * 4) *
+			                    MAKI_NAME_ZOOM) >> 17);
+			int16_t y = 120 - ((font->height * MAKI_NAME_ZOOM) >> 17);
+			sdfDrawString(buffer, font, "maki", x, y, MAKI_NAME_ZOOM, &style);
 		}
 
 		return true;
 	}
 
+	// only the battery changes, so only send its rows
+
+	CompositorRect rect;
+	if (compositorRender(&state->compositor, buffer, &rect)) {
+		pipelineSubmitWindow(rect.x0, rect.y0, rect.x1, rect.y1);
+	}
+
 	return false;
 }
 
-#endif
\ No newline at end of file
+// screen manager hooks
+
+void MakiProfilePictureScreenInit(void* state) {
+	InitMakiProfilePictureScreenState(state);
+}
+
+void MakiProfilePictureScreenEnter(void* screenState) {
+	MakiProfilePictureScreenState* state = screenState;
+	state->image = assetCacheGet(&assetCache, ASSET_MAKI_IMAGE);
+	assetCachePin(&assetCache, ASSET_MAKI_IMAGE);
+	state->compositor.background = state->image;
+}
+
+void MakiProfilePictureScreenLeave(void* screenState) {
+	MakiProfilePictureScreenState* state = screenState;
+	assetCacheUnpin(&assetCache, ASSET_MAKI_IMAGE);
+	state->compositor.background = NULL;
+	state->image = NULL;
+}
+
+void MakiProfilePictureScreenPrefetch(void* state) {
+	assetCachePrefetch(&assetCache, ASSET_MAKI_IMAGE);
+}
+
+bool MakiProfilePictureScreenRender(void* state, uint16_t* buffer,
+                                    bool redraw) {
+	return MakiProfilePictureScreen(state, buffer, redraw);
+}
+
+#endif
@@ -17,4 +17,10 @@ bool MechanyxScreen(uint16_t* buffer, bool redraw) {
 	return false;
 }
 
+// screen manager hooks, the image stays in flash
+
+bool MechanyxScreenRender(void* state, uint16_t* buffer, bool redraw) {
+	return MechanyxScreen(buffer, redraw);
+}
+
 #endif
\ No newline at end of file
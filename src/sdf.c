@@ -0,0 +1,108 @@
+#include "sdf.h"
+
+#include "rgb565.h"
+
+// alpha is 0 to 256 and may be out of range either way
+static inline uint16_t blendPixel(uint16_t under, uint16_t over,
+                                  int32_t alpha) {
+	if (alpha <= 0) return under;
+	if (alpha >= 256) return over;
+	return rgb565BlendPixel(under, over, (alpha + 4) >> 3);
+}
+
+void sdfDraw(uint16_t* buffer, const SdfField* field, uint8_t glyph,
+             int16_t x, int16_t y, int32_t zoom, const SdfStyle* style) {
+	if (glyph >= field->count) return;
+	if (zoom > SDF_MAX_ZOOM) zoom = SDF_MAX_ZOOM;
+	if (zoom < 4096) zoom = 4096;
+
+	const uint8_t* data = &field->data[glyph * field->width * field->height];
+
+	// field pixels per screen pixel, Q16
+	int32_t inverse = (((int64_t)1 << 32) + zoom / 2) / zoom;
+
+	// field value to screen distance, 127 steps are spread field pixels
+	int32_t distanceScale = (int64_t)field->spread * zoom / 127;
+
+	int32_t glowScale = style->glowWidth > 0 ? 65536 / style->glowWidth : 0;
+	int32_t reach = style->outlineWidth + style->glowWidth + 128;
+
+	int16_t x0 = x < 0 ? 0 : x;
+	int16_t y0 = y < 0 ? 0 : y;
+	int32_t x1 = x + (((int32_t)field->width * zoom) >> 16);
+	int32_t y1 = y + (((int32_t)field->height * zoom) >> 16);
+	if (x1 > SDF_WIDTH) x1 = SDF_WIDTH;
+	if (y1 > SDF_HEIGHT) y1 = SDF_HEIGHT;
+
+	for (int16_t row = y0; row < y1; row++) {
+		// sample between field pixel centers
+		int32_t v = (row - y) * inverse + inverse / 2 - 32768;
+		int32_t fieldY = v >> 16;
+		uint32_t fy = (v >> 8) & 0xff;
+		const uint8_t* line0 =
+		    &data[(fieldY < 0 ? 0 : fieldY) * field->width];
+		const uint8_t* line1 =
+		    &data[(fieldY + 1 >= field->height ? field->height - 1
+		                                        : fieldY + 1) *
+		          field->width];
+
+		int32_t u = (x0 - x) * inverse + inverse / 2 - 32768;
+		uint16_t* out = &buffer[row * SDF_WIDTH];
+
+		for (int16_t column = x0; column < x1; column++, u += inverse) {
+			int32_t fieldX = u >> 16;
+			uint32_t fx = (u >> 8) & 0xff;
+			int32_t left = fieldX < 0 ? 0 : fieldX;
+			int32_t right =
+			    fieldX + 1 >= field->width ? field->width - 1 : fieldX + 1;
+
+			uint32_t top = line0[left] * (256 - fx) + line0[right] * fx;
+			uint32_t bottom = line1[left] * (256 - fx) + line1[right] * fx;
+			int32_t value = (top * (256 - fy) + bottom * fy) >> 8;
+
+			// screen pixels in 1/256, positive inside
+			int32_t distance = ((value - 128 * 256) >> 2) * distanceScale >> 14;
+			if (distance < -reach) continue;
+
+			uint16_t pixel = out[column];
+
+			if (glowScale > 0) {
+				int32_t outside = distance + style->outlineWidth;
+				int32_t alpha =
+				    outside >= 0 ? 256 : 256 + ((outside * glowScale) >> 8);
+				pixel = blendPixel(pixel, style->glowColor, alpha);
+			}
+
+			if (style->outlineWidth > 0) {
+				pixel = blendPixel(pixel, style->outlineColor,
+				                   distance + style->outlineWidth + 128);
+			}
+
+			out[column] = blendPixel(pixel, style->color, distance + 128);
+		}
+	}
+}
+
+void sdfDrawString(uint16_t* buffer, const SdfField* field, const char* text,
+                   int16_t x, int16_t y, int32_t zoom, const SdfStyle* style) {
+	// kept in Q16 so rounding doesn't add up along the string
+	int32_t position = (int32_t)x << 16;
+	int32_t advance = field->advance * zoom;
+
+	for (; *text != '\0'; text++) {
+		int16_t glyph = -1;
+		if (field->glyphs != NULL) {
+			for (uint8_t i = 0; i < field->count; i++) {
+				if (field->glyphs[i] == *text) glyph = i;
+			}
+		} else if ((uint8_t)*text >= field->first) {
+			glyph = (uint8_t)*text - field->first;
+		}
+
+		// sdfDraw skips anything past count
+		if (glyph >= 0) {
+			sdfDraw(buffer, field, glyph, position >> 16, y, zoom, style);
+		}
+		position += advance;
+	}
+}
@@ -0,0 +1,48 @@
+#ifndef MAKI_SDF_H
+#define MAKI_SDF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// signed distance field assets, from assets/make-sdf.ts. a small field
+// renders with crisp anti-aliased edges at any zoom, plus an outline and
+// glow for free
+//
+// each byte is the distance to the nearest edge, 128 on the edge, above
+// inside and below outside. 127 steps cover spread field pixels, at most 16
+
+typedef struct {
+	uint16_t width;   // per glyph, including padding
+	uint16_t height;
+	uint8_t spread;
+	uint8_t count;    // glyphs, 1 for images
+	uint8_t first;    // ascii code of the first glyph
+	uint8_t advance;  // field pixels between glyphs
+	const uint8_t* data;
+	// ascii codes of the glyphs in order when only some were made, NULL
+	// for every one from first
+	const char* glyphs;
+} SdfField;
+
+typedef struct {
+	uint16_t color;
+	uint16_t outlineColor;
+	uint16_t glowColor;
+	// in 1/256 screen pixels, 0 for none
+	int32_t outlineWidth;
+	int32_t glowWidth;
+} SdfStyle;
+
+#define SDF_WIDTH 240
+#define SDF_HEIGHT 240
+// keeps the fixed point math in 32 bits
+#define SDF_MAX_ZOOM (12 * 65536)
+
+// zoom is Q16 screen pixels per field pixel. colors are the byte swapped
+// rgb565 of the screen buffer
+void sdfDraw(uint16_t* buffer, const SdfField* field, uint8_t glyph,
+             int16_t x, int16_t y, int32_t zoom, const SdfStyle* style);
+void sdfDrawString(uint16_t* buffer, const SdfField* field, const char* text,
+                   int16_t x, int16_t y, int32_t zoom, const SdfStyle* style);
+
+#endif
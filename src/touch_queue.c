@@ -0,0 +1,35 @@
+#include "touch_queue.h"
+
+void touchQueueInit(TouchQueue* queue) {
+	queue->head = 0;
+	queue->tail = 0;
+	queue->dropped = 0;
+}
+
+bool touchQueuePush(TouchQueue* queue, uint32_t time, uint32_t events) {
+	uint8_t head = queue->head;
+	if ((uint8_t)(head - queue->tail) == TOUCH_QUEUE_SIZE) {
+		queue->dropped++;
+		return false;
+	}
+
+	queue->events[head % TOUCH_QUEUE_SIZE] = (TouchEvent){time, events};
+
+	// the event has to be there before the consumer sees the new head
+	__sync_synchronize();
+	queue->head = head + 1;
+	return true;
+}
+
+bool touchQueuePop(TouchQueue* queue, TouchEvent* event) {
+	uint8_t tail = queue->tail;
+	if (tail == queue->head) return false;
+
+	__sync_synchronize();
+	*event = queue->events[tail % TOUCH_QUEUE_SIZE];
+
+	// and read out before the producer can reuse the slot
+	__sync_synchronize();
+	queue->tail = tail + 1;
+	return true;
+}
@@ -0,0 +1,35 @@
+#ifndef MAKI_TOUCH_QUEUE_H
+#define MAKI_TOUCH_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// touch interrupts go through here so the handler doesn't block on i2c.
+// the interrupt only timestamps and pushes, the main loop pops and reads
+// the controller. one producer and one consumer, each index is only
+// written by one side, so no locks
+
+// power of two so the indices can just wrap
+#define TOUCH_QUEUE_SIZE 16
+
+typedef struct {
+	uint32_t time;  // us since boot when the interrupt fired
+	uint32_t events;  // GPIO_IRQ_* from the callback
+} TouchEvent;
+
+typedef struct {
+	TouchEvent events[TOUCH_QUEUE_SIZE];
+	volatile uint8_t head;  // written by the interrupt
+	volatile uint8_t tail;  // written by the main loop
+	volatile uint32_t dropped;
+} TouchQueue;
+
+void touchQueueInit(TouchQueue* queue);
+
+// from the interrupt, false and counted as dropped when full
+bool touchQueuePush(TouchQueue* queue, uint32_t time, uint32_t events);
+
+// from the main loop, false when empty
+bool touchQueuePop(TouchQueue* queue, TouchEvent* event);
+
+#endif
@@ -0,0 +1,229 @@
+#include "transition.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "parallel.h"
+#include "pipeline.h"
+#include "rgb565.h"
+
+#define FRAME_BYTES (TRANSITION_WIDTH * TRANSITION_HEIGHT * 2)
+
+// the display is round, nothing past this shows
+#define WIPE_CENTER 120
+#define WIPE_RADIUS 121
+
+void transitionInit(Transition* transition, AssetCache* cache) {
+	transition->cache = cache;
+	transition->incoming = NULL;
+	transition->active = false;
+}
+
+uint16_t* transitionBegin(Transition* transition, TransitionType type,
+                          uint16_t* buffer, uint32_t duration, uint32_t now) {
+	transition->active = false;
+	if (type == TRANSITION_CUT || duration == 0) return buffer;
+
+	// the old screen's assets are unpinned by now, so this can evict them
+	transition->incoming = assetCacheBorrow(transition->cache, FRAME_BYTES);
+
+	if (transition->incoming == NULL) {
+#ifdef PIPELINE_DOUBLE_BUFFER
+		return buffer;
+#else
+		// pushes still come in from their side, see transition.h
+		if (type == TRANSITION_CROSSFADE) type = TRANSITION_WIPE;
+#endif
+	}
+
+	transition->type = type;
+	transition->start = now;
+	transition->duration = duration;
+	transition->progress = 0;
+	transition->active = true;
+
+	return transition->incoming != NULL ? transition->incoming : buffer;
+}
+
+bool transitionActive(Transition* transition) { return transition->active; }
+
+// slow in and out
+static uint16_t easedProgress(Transition* transition, uint32_t now) {
+	uint32_t elapsed = now - transition->start;
+	if (elapsed >= transition->duration) return TRANSITION_FULL;
+
+	uint32_t t = elapsed * TRANSITION_FULL / transition->duration;
+	return t * t * (3 * TRANSITION_FULL - 2 * t) /
+	       (TRANSITION_FULL * TRANSITION_FULL);
+}
+
+// rows are split across both cores
+
+typedef struct {
+	uint16_t* buffer;
+	const uint16_t* incoming;
+	uint16_t alpha;
+	uint16_t offset;
+	uint16_t previousOffset;
+} StepJob;
+
+static void crossfadeRows(void* context, uint16_t start, uint16_t end) {
+	StepJob* job = context;
+	uint32_t first = start * TRANSITION_WIDTH;
+	rgb565Blend(&job->buffer[first], &job->incoming[first],
+	            (end - start) * TRANSITION_WIDTH, job->alpha);
+}
+
+static void pushLeftRows(void* context, uint16_t start, uint16_t end) {
+	StepJob* job = context;
+	uint16_t offset = job->offset;
+	uint16_t shift = offset - job->previousOffset;
+
+	for (uint16_t y = start; y < end; y++) {
+		uint16_t* row = &job->buffer[y * TRANSITION_WIDTH];
+		const uint16_t* incoming = &job->incoming[y * TRANSITION_WIDTH];
+
+		// what's left of the old row moves over, the new one follows it
+		memmove(row, row + shift, (TRANSITION_WIDTH - offset) * 2);
+		memcpy(row + TRANSITION_WIDTH - offset, incoming, offset * 2);
+	}
+}
+
+static void pushRightRows(void* context, uint16_t start, uint16_t end) {
+	StepJob* job = context;
+	uint16_t offset = job->offset;
+	uint16_t previousOffset = job->previousOffset;
+
+	for (uint16_t y = start; y < end; y++) {
+		uint16_t* row = &job->buffer[y * TRANSITION_WIDTH];
+		const uint16_t* incoming = &job->incoming[y * TRANSITION_WIDTH];
+
+		memmove(row + offset, row + previousOffset,
+		        (TRANSITION_WIDTH - offset) * 2);
+		memcpy(row, incoming + TRANSITION_WIDTH - offset, offset * 2);
+	}
+}
+
+static uint16_t isqrt(uint32_t value) {
+	uint32_t root = 0;
+	for (uint32_t bit = 1 << 14; bit > 0; bit >>= 1) {
+		uint32_t next = root | bit;
+		if (next * next <= value) root = next;
+	}
+	return root;
+}
+
+// half the width of the circle on row y
+static uint16_t wipeSpan(uint16_t radius, uint16_t y) {
+	uint16_t dy = y < WIPE_CENTER ? WIPE_CENTER - 1 - y : y - WIPE_CENTER;
+	if (dy >= radius) return 0;
+
+	uint16_t span = isqrt(radius * radius - dy * dy);
+	return span < WIPE_CENTER ? span : WIPE_CENTER;
+}
+
+static void wipe(Transition* transition, uint16_t* buffer, uint16_t progress) {
+	uint16_t radius = progress * WIPE_RADIUS / TRANSITION_FULL;
+	uint16_t previousRadius =
+	    transition->progress * WIPE_RADIUS / TRANSITION_FULL;
+	if (radius == previousRadius) return;
+
+	uint16_t top = radius < WIPE_CENTER ? WIPE_CENTER - radius : 0;
+	uint16_t bottom = WIPE_CENTER + radius < TRANSITION_HEIGHT
+	                      ? WIPE_CENTER + radius
+	                      : TRANSITION_HEIGHT;
+
+	if (transition->incoming != NULL) {
+		for (uint16_t y = top; y < bottom; y++) {
+			uint16_t span = wipeSpan(radius, y);
+			uint32_t first = y * TRANSITION_WIDTH + WIPE_CENTER - span;
+			memcpy(&buffer[first], &transition->incoming[first], span * 4);
+		}
+
+		// outside the circle is still the old frame, so the box around it
+		// is fine. it's centered, so square
+		pipelineSubmitWindow(top, top, bottom, bottom);
+		return;
+	}
+
+	// the new frame is already in the buffer and the old one is only on
+	// the panel, so send just inside the circle, one row at a time
+	for (uint16_t y = top; y < bottom; y++) {
+		uint16_t span = wipeSpan(radius, y);
+		if (span == wipeSpan(previousRadius, y)) continue;
+		pipelineSubmitWindow(WIPE_CENTER - span, y, WIPE_CENTER + span, y + 1);
+	}
+}
+
+void transitionStep(Transition* transition, uint32_t now) {
+	if (!transition->active) return;
+
+	uint16_t progress = easedProgress(transition, now);
+	if (progress == transition->progress) return;
+
+	uint16_t* buffer = pipelineBuffer();
+	uint16_t previous = transition->progress;
+
+	StepJob job = {buffer, transition->incoming};
+
+	switch (transition->type) {
+		case TRANSITION_CROSSFADE:
+			// the buffer is already part way, so blend what's left of the
+			// way from there
+			job.alpha = (progress - previous) * TRANSITION_FULL /
+			            (TRANSITION_FULL - previous);
+			parallelFor(TRANSITION_HEIGHT, crossfadeRows, &job);
+			pipelineSubmit();
+			break;
+
+		case TRANSITION_PUSH_LEFT:
+		case TRANSITION_PUSH_RIGHT:
+			job.offset = progress * TRANSITION_WIDTH / TRANSITION_FULL;
+			job.previousOffset = previous * TRANSITION_WIDTH / TRANSITION_FULL;
+			if (job.offset == job.previousOffset) break;
+
+			// the new frame is already in the buffer, send the strip it
+			// slid in over
+			if (transition->incoming == NULL) {
+				if (transition->type == TRANSITION_PUSH_LEFT) {
+					pipelineSubmitWindow(TRANSITION_WIDTH - job.offset, 0,
+					                     TRANSITION_WIDTH - job.previousOffset,
+					                     TRANSITION_HEIGHT);
+				} else {
+					pipelineSubmitWindow(job.previousOffset, 0, job.offset,
+					                     TRANSITION_HEIGHT);
+				}
+				break;
+			}
+
+			parallelFor(TRANSITION_HEIGHT,
+			            transition->type == TRANSITION_PUSH_LEFT
+			                ? pushLeftRows
+			                : pushRightRows,
+			            &job);
+			pipelineSubmit();
+			break;
+
+		default:
+			wipe(transition, buffer, progress);
+			break;
+	}
+
+	transition->progress = progress;
+	if (progress < TRANSITION_FULL) return;
+
+	// blends round a little each step, the end has to be exact
+	if (transition->incoming != NULL) {
+		buffer = pipelineBuffer();
+		if (memcmp(buffer, transition->incoming, FRAME_BYTES) != 0) {
+			memcpy(buffer, transition->incoming, FRAME_BYTES);
+			pipelineSubmit();
+		}
+
+		// core1 only ever reads the pipeline buffers
+		assetCacheReturn(transition->cache, transition->incoming, FRAME_BYTES);
+		transition->incoming = NULL;
+	}
+
+	transition->active = false;
+}
@@ -0,0 +1,62 @@
+#ifndef MAKI_TRANSITION_H
+#define MAKI_TRANSITION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "asset_cache.h"
+
+// animates between screens without rendering either again
+//
+// usually there's no room for a second frame. it's 115,200 of the
+// 122,880 byte asset budget, so it only fits when the new screen has
+// almost nothing decoded or borrowed. otherwise the new screen renders
+// straight into the pipeline buffer while the panel still shows the old
+// frame, and each step sends just the part that's been uncovered. pushes
+// slide in from their side like that and crossfades become a circular
+// wipe
+//
+// only when a frame fits next to the new screen's assets does it render
+// into a copy borrowed from the asset cache. each step then moves the
+// buffer towards the copy in place and sends what changed, so the old
+// frame can actually move or fade
+//
+// with PIPELINE_DOUBLE_BUFFER there's no budget to borrow from and the
+// buffers swap on every send, so it's always a cut
+
+#define TRANSITION_WIDTH 240
+#define TRANSITION_HEIGHT 240
+#define TRANSITION_FULL 256
+
+typedef enum {
+	TRANSITION_CUT,
+	TRANSITION_CROSSFADE,
+	TRANSITION_PUSH_LEFT,  // new screen comes in from the right
+	TRANSITION_PUSH_RIGHT,
+	TRANSITION_WIPE,  // circle out from the middle
+} TransitionType;
+
+typedef struct {
+	AssetCache* cache;
+
+	TransitionType type;
+	uint16_t* incoming;  // borrowed, NULL when it didn't fit
+	uint32_t start;
+	uint32_t duration;
+	uint16_t progress;  // eased, of the last step
+	bool active;
+} Transition;
+
+void transitionInit(Transition* transition, AssetCache* cache);
+
+// after screenManagerSwitch and before the new screen renders. returns
+// where to render it, which is buffer unless there's a copy
+uint16_t* transitionBegin(Transition* transition, TransitionType type,
+                          uint16_t* buffer, uint32_t duration, uint32_t now);
+bool transitionActive(Transition* transition);
+
+// moves on to now and sends what changed. the last step leaves the new
+// screen in the pipeline buffer, so it can carry on from there
+void transitionStep(Transition* transition, uint32_t now);
+
+#endif
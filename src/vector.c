@@ -0,0 +1,340 @@
+#include "vector.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "GUI_Paint.h"
+#include "rgb565.h"
+
+// 4 sub scanlines per pixel row, x is kept in 1/256 pixels so span ends
+// give partial coverage horizontally too
+#define SUBSAMPLES 4
+#define SUBSAMPLE_STEP (256 / SUBSAMPLES)
+
+typedef struct {
+	int32_t x;     // 1/65536 pixels at the first sub scanline
+	int32_t step;  // per sub scanline
+	int16_t top;   // first sub scanline, inclusive
+	int16_t bottom;
+	int8_t winding;
+} Edge;
+
+typedef struct {
+	int32_t x;
+	int8_t winding;
+} Crossing;
+
+static Edge edges[VECTOR_MAX_EDGES];
+static uint16_t edgeCount;
+// an edge didn't fit, that fill is missing part of its outline
+static bool edgesDropped;
+
+// rounds down, unlike / for negative numbers
+static int32_t floorDivide(int32_t value, int32_t divisor) {
+	return value >= 0 ? value / divisor : -((-value + divisor - 1) / divisor);
+}
+
+static int16_t readInt16(const uint8_t* data) {
+	return (int16_t)(data[0] | (data[1] << 8));
+}
+
+void vectorTransformInit(VectorTransform* transform, const uint8_t* asset,
+                         int16_t angle, int32_t zoom, int16_t centerX,
+                         int16_t centerY) {
+	int32_t cosZoom = ((int64_t)Paint_Cos(angle) * zoom) >> 16;
+	int32_t sinZoom = ((int64_t)Paint_Sin(angle) * zoom) >> 16;
+
+	transform->a = cosZoom;
+	transform->b = -sinZoom;
+	transform->c = sinZoom;
+	transform->d = cosZoom;
+
+	transform->originX = readInt16(asset) * 16 / 2;
+	transform->originY = readInt16(asset + 2) * 16 / 2;
+
+	transform->x = centerX * 256 + 128;
+	transform->y = centerY * 256 + 128;
+}
+
+// view point to screen, 1/256 pixels
+static void transformPoint(const VectorTransform* transform, int32_t x,
+                           int32_t y, int32_t* outX, int32_t* outY) {
+	x -= transform->originX;
+	y -= transform->originY;
+	*outX = (((int64_t)transform->a * x + (int64_t)transform->b * y) >> 12) +
+	        transform->x;
+	*outY = (((int64_t)transform->c * x + (int64_t)transform->d * y) >> 12) +
+	        transform->y;
+}
+
+static void addEdge(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+	int8_t winding = 1;
+	if (y0 > y1) {
+		int32_t swap = x0;
+		x0 = x1;
+		x1 = swap;
+		swap = y0;
+		y0 = y1;
+		y1 = swap;
+		winding = -1;
+	}
+
+	// sub scanline s samples at y = s * 64 + 32, first one at or below
+	int32_t top = floorDivide(y0 - SUBSAMPLE_STEP / 2 + SUBSAMPLE_STEP - 1,
+	                          SUBSAMPLE_STEP);
+	int32_t bottom = floorDivide(y1 - SUBSAMPLE_STEP / 2 + SUBSAMPLE_STEP - 1,
+	                             SUBSAMPLE_STEP);
+
+	if (top >= bottom) return;
+	if (bottom <= 0 || top >= VECTOR_HEIGHT * SUBSAMPLES) return;
+	if (edgeCount >= VECTOR_MAX_EDGES) {
+		edgesDropped = true;
+		return;
+	}
+
+	int64_t slope = (int64_t)(x1 - x0) * 65536 / (y1 - y0);
+
+	Edge* edge = &edges[edgeCount++];
+	edge->top = top;
+	edge->bottom = bottom;
+	edge->winding = winding;
+	edge->step = slope * SUBSAMPLE_STEP >> 8;
+	edge->x = (int64_t)x0 * 256 +
+	          ((slope * (top * SUBSAMPLE_STEP + SUBSAMPLE_STEP / 2 - y0)) >> 8);
+}
+
+// curves become this many lines, more the longer they are on screen
+static int32_t curveSegments(int32_t length) {
+	int32_t segments = length / (256 * 4);
+	if (segments < 2) return 2;
+	if (segments > 32) return 32;
+	return segments;
+}
+
+static int32_t absolute(int32_t value) { return value < 0 ? -value : value; }
+
+static void addQuad(int32_t x0, int32_t y0, int32_t cx, int32_t cy,
+                    int32_t x1, int32_t y1) {
+	int32_t n = curveSegments(absolute(cx - x0) + absolute(cy - y0) +
+	                          absolute(x1 - cx) + absolute(y1 - cy));
+	int64_t nn = n * n;
+	int32_t lastX = x0, lastY = y0;
+
+	for (int32_t i = 1; i <= n; i++) {
+		int64_t u = n - i;
+		int32_t x = (u * u * x0 + 2 * u * i * cx + (int64_t)i * i * x1) / nn;
+		int32_t y = (u * u * y0 + 2 * u * i * cy + (int64_t)i * i * y1) / nn;
+		addEdge(lastX, lastY, x, y);
+		lastX = x;
+		lastY = y;
+	}
+}
+
+static void addCubic(int32_t x0, int32_t y0, int32_t c1x, int32_t c1y,
+                     int32_t c2x, int32_t c2y, int32_t x1, int32_t y1) {
+	int32_t n = curveSegments(
+	    absolute(c1x - x0) + absolute(c1y - y0) + absolute(c2x - c1x) +
+	    absolute(c2y - c1y) + absolute(x1 - c2x) + absolute(y1 - c2y));
+	int64_t nnn = n * n * n;
+	int32_t lastX = x0, lastY = y0;
+
+	for (int32_t i = 1; i <= n; i++) {
+		int64_t u = n - i;
+		int64_t t = i;
+		int32_t x = (u * u * u * x0 + 3 * u * u * t * c1x +
+		             3 * u * t * t * c2x + t * t * t * x1) /
+		            nnn;
+		int32_t y = (u * u * u * y0 + 3 * u * u * t * c1y +
+		             3 * u * t * t * c2y + t * t * t * y1) /
+		            nnn;
+		addEdge(lastX, lastY, x, y);
+		lastX = x;
+		lastY = y;
+	}
+}
+
+static int compareEdges(const void* a, const void* b) {
+	return ((const Edge*)a)->top - ((const Edge*)b)->top;
+}
+
+// coverage of one pixel row, 256 is fully covered
+static uint16_t coverage[VECTOR_WIDTH];
+
+static void addSpan(int32_t x0, int32_t x1, int16_t* minX, int16_t* maxX) {
+	// 1/65536 pixels to 1/256
+	x0 >>= 8;
+	x1 >>= 8;
+	if (x0 < 0) x0 = 0;
+	if (x1 > VECTOR_WIDTH * 256) x1 = VECTOR_WIDTH * 256;
+	if (x0 >= x1) return;
+
+	int16_t first = x0 >> 8;
+	int16_t last = (x1 - 1) >> 8;
+
+	if (first < *minX) *minX = first;
+	if (last > *maxX) *maxX = last;
+
+	if (first == last) {
+		coverage[first] += (x1 - x0) / SUBSAMPLES;
+		return;
+	}
+
+	coverage[first] += (((first + 1) << 8) - x0) / SUBSAMPLES;
+	for (int16_t x = first + 1; x < last; x++) {
+		coverage[x] += 256 / SUBSAMPLES;
+	}
+	coverage[last] += (x1 - (last << 8)) / SUBSAMPLES;
+}
+
+static void fill(uint16_t* buffer, uint16_t color) {
+	if (edgeCount == 0) return;
+
+	qsort(edges, edgeCount, sizeof(Edge), compareEdges);
+
+	static uint16_t active[VECTOR_MAX_EDGES];
+	static Crossing crossings[VECTOR_MAX_EDGES];
+	uint16_t activeCount = 0;
+	uint16_t nextEdge = 0;
+
+	int16_t firstRow = edges[0].top / SUBSAMPLES;
+	if (firstRow < 0) firstRow = 0;
+
+	for (int16_t row = firstRow; row < VECTOR_HEIGHT; row++) {
+		if (nextEdge >= edgeCount && activeCount == 0) break;
+
+		int16_t minX = VECTOR_WIDTH, maxX = -1;
+
+		for (int16_t s = row * SUBSAMPLES; s < (row + 1) * SUBSAMPLES; s++) {
+			// drop finished edges, pick up starting ones
+
+			uint16_t kept = 0;
+			for (uint16_t i = 0; i < activeCount; i++) {
+				if (edges[active[i]].bottom > s) active[kept++] = active[i];
+			}
+			activeCount = kept;
+
+			while (nextEdge < edgeCount && edges[nextEdge].top <= s) {
+				Edge* edge = &edges[nextEdge];
+				if (edge->bottom > s) {
+					// may start above the screen
+					edge->x += edge->step * (s - edge->top);
+					active[activeCount++] = nextEdge;
+				}
+				nextEdge++;
+			}
+
+			// sorted crossings, few enough for insertion sort
+
+			uint16_t crossingCount = 0;
+			for (uint16_t i = 0; i < activeCount; i++) {
+				Edge* edge = &edges[active[i]];
+				uint16_t j = crossingCount++;
+				while (j > 0 && crossings[j - 1].x > edge->x) {
+					crossings[j] = crossings[j - 1];
+					j--;
+				}
+				crossings[j].x = edge->x;
+				crossings[j].winding = edge->winding;
+				edge->x += edge->step;
+			}
+
+			int16_t winding = 0;
+			for (uint16_t i = 0; i + 1 < crossingCount; i++) {
+				winding += crossings[i].winding;
+				if (winding != 0) {
+					addSpan(crossings[i].x, crossings[i + 1].x, &minX, &maxX);
+				}
+			}
+		}
+
+		uint16_t* out = &buffer[row * VECTOR_WIDTH];
+		for (int16_t x = minX; x <= maxX; x++) {
+			uint16_t covered = coverage[x];
+			coverage[x] = 0;
+			if (covered >= 256 - SUBSAMPLES) {
+				out[x] = color;
+			} else if (covered > 0) {
+				out[x] = rgb565BlendPixel(out[x], color, (covered + 4) >> 3);
+			}
+		}
+	}
+
+	edgeCount = 0;
+}
+
+bool vectorDraw(uint16_t* buffer, const uint8_t* asset,
+                const VectorTransform* transform) {
+	const uint8_t* data = asset + 4;
+
+	uint16_t color = 0xffff;
+	int32_t startX = 0, startY = 0;
+	int32_t lastX = 0, lastY = 0;
+	int32_t points[6];
+
+	edgeCount = 0;
+	edgesDropped = false;
+
+	while (true) {
+		uint8_t command = *data++;
+		uint8_t pointCount = command == VECTOR_MOVE || command == VECTOR_LINE ? 1
+		                     : command == VECTOR_QUAD                       ? 2
+		                     : command == VECTOR_CUBIC                      ? 3
+		                                                                    : 0;
+
+		for (uint8_t i = 0; i < pointCount; i++) {
+			transformPoint(transform, readInt16(data), readInt16(data + 2),
+			               &points[i * 2], &points[i * 2 + 1]);
+			data += 4;
+		}
+
+		switch (command) {
+			case VECTOR_COLOR: {
+				uint16_t rgb = ((data[0] & 0xf8) << 8) |
+				               ((data[1] & 0xfc) << 3) | (data[2] >> 3);
+				color = (rgb >> 8) | (rgb << 8);
+				data += 3;
+				break;
+			}
+			case VECTOR_MOVE:
+				// contours close themselves for filling
+				if (lastX != startX || lastY != startY) {
+					addEdge(lastX, lastY, startX, startY);
+				}
+				startX = lastX = points[0];
+				startY = lastY = points[1];
+				break;
+			case VECTOR_LINE:
+				addEdge(lastX, lastY, points[0], points[1]);
+				lastX = points[0];
+				lastY = points[1];
+				break;
+			case VECTOR_QUAD:
+				addQuad(lastX, lastY, points[0], points[1], points[2],
+				        points[3]);
+				lastX = points[2];
+				lastY = points[3];
+				break;
+			case VECTOR_CUBIC:
+				addCubic(lastX, lastY, points[0], points[1], points[2],
+				         points[3], points[4], points[5]);
+				lastX = points[4];
+				lastY = points[5];
+				break;
+			case VECTOR_CLOSE:
+				addEdge(lastX, lastY, startX, startY);
+				lastX = startX;
+				lastY = startY;
+				break;
+			case VECTOR_FILL:
+				addEdge(lastX, lastY, startX, startY);
+				lastX = startX;
+				lastY = startY;
+				fill(buffer, color);
+				break;
+			case VECTOR_END:
+				return !edgesDropped;
+			default:
+				return false;
+		}
+	}
+}
@@ -0,0 +1,61 @@
+#ifndef MAKI_VECTOR_H
+#define MAKI_VECTOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// draws filled vector paths, anti-aliased, at any scale or rotation.
+// assets come from assets/make-vector.ts
+//
+// asset format, little endian:
+//
+// [uint16: view width] [uint16: view height]
+//
+// ...then commands, each an opcode byte followed by its arguments.
+// coordinates are int16 in 1/16 view units
+//
+// VECTOR_COLOR r g b    sets the fill color
+// VECTOR_MOVE x y       starts a new contour
+// VECTOR_LINE x y
+// VECTOR_QUAD cx cy x y
+// VECTOR_CUBIC c1x c1y c2x c2y x y
+// VECTOR_CLOSE          back to the start of the contour
+// VECTOR_FILL           fills everything since the last fill, nonzero
+// VECTOR_END
+
+#define VECTOR_WIDTH 240
+#define VECTOR_HEIGHT 240
+#define VECTOR_MAX_EDGES 384
+
+enum {
+	VECTOR_END = 0,
+	VECTOR_COLOR,
+	VECTOR_MOVE,
+	VECTOR_LINE,
+	VECTOR_QUAD,
+	VECTOR_CUBIC,
+	VECTOR_CLOSE,
+	VECTOR_FILL,
+};
+
+// view units in 1/16 to screen pixels in 1/256, Q16 matrix
+typedef struct {
+	int32_t a, b;
+	int32_t c, d;
+	int32_t originX, originY;  // view point that lands on x, y
+	int32_t x, y;              // screen pixels in 1/256
+} VectorTransform;
+
+// angle is clockwise, ANGLE_FULL_TURN per turn. zoom is Q16, 65536 draws
+// one view unit per pixel. the middle of the view lands on centerX, centerY
+void vectorTransformInit(VectorTransform* transform, const uint8_t* asset,
+                         int16_t angle, int32_t zoom, int16_t centerX,
+                         int16_t centerY);
+
+// draws onto the byte swapped rgb565 screen buffer. false if a fill had
+// more than VECTOR_MAX_EDGES edges, which make-vector.ts checks for, or
+// the asset is broken. what fit is drawn either way
+bool vectorDraw(uint16_t* buffer, const uint8_t* asset,
+                const VectorTransform* transform);
+
+#endif
@@ -0,0 +1,177 @@
+// anti-aliased text against the font compiler's output. widths are summed
+// straight from the glyph and kerning tables, and strings are drawn pixel
+// by pixel from the packed bitmap with an exact blend, over random
+// backgrounds and partly off the image. see run.sh
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "GUI_Paint.h"
+#include "lato_20.h"
+
+#define TEST_ROUNDS 2000
+
+static uint8_t Test_Image[240 * 240 * 2];
+static uint8_t Test_Expected[240 * 240 * 2];
+
+static uint16_t Test_Width(const char * pString, const aFONT* Font)
+{
+    int16_t Width = 0;
+
+    for (; *pString != '\0'; pString++) {
+        uint8_t Code = *pString;
+        if (Code >= Font->first && Code <= Font->last)
+            Width += Font->glyphs[Code - Font->first].advance;
+        if (*(pString + 1) == '\0')
+            continue;
+        for (uint16_t i = 0; i < Font->kerning_size; i++) {
+            if (Font->kerning[i].left == Code && Font->kerning[i].right == (uint8_t)*(pString + 1))
+                Width += Font->kerning[i].adjust;
+        }
+    }
+
+    return Width < 0 ? 0 : Width;
+}
+
+static uint8_t Test_Level(const aFONT* Font, const aGLYPH* Glyph, int16_t X, int16_t Y)
+{
+    uint32_t Bit = (Y * Glyph->width + X) * Font->bpp;
+    uint8_t Byte = Font->bitmap[Glyph->offset + Bit / 8];
+    return (Byte >> (8 - Font->bpp - Bit % 8)) & ((1 << Font->bpp) - 1);
+}
+
+// rounded to the nearest step, the blitter may be off by one
+static uint16_t Test_Blend(uint16_t Background, uint16_t Color, uint8_t Level, uint8_t Max)
+{
+    uint16_t Result = 0;
+    const uint8_t Shift[3] = {11, 5, 0};
+    const uint8_t Mask[3] = {0x1f, 0x3f, 0x1f};
+
+    for (uint8_t i = 0; i < 3; i++) {
+        int32_t Under = (Background >> Shift[i]) & Mask[i];
+        int32_t Over = (Color >> Shift[i]) & Mask[i];
+        int32_t Value = (Under * (Max - Level) * 2 + Over * Level * 2 + Max) / (Max * 2);
+        Result |= Value << Shift[i];
+    }
+
+    return Result;
+}
+
+static void Test_DrawString(int16_t Xstart, int16_t Ystart, const char * pString,
+                            const aFONT* Font, uint16_t Color)
+{
+    int16_t Pen = Xstart;
+    uint8_t Max = (1 << Font->bpp) - 1;
+
+    for (; *pString != '\0'; pString++) {
+        uint8_t Code = *pString;
+        if (Code < Font->first || Code > Font->last)
+            continue;
+        const aGLYPH *Glyph = &Font->glyphs[Code - Font->first];
+
+        for (int16_t Y = 0; Y < Glyph->height; Y++) {
+            for (int16_t X = 0; X < Glyph->width; X++) {
+                int16_t Xpoint = Pen + Glyph->x_offset + X;
+                int16_t Ypoint = Ystart + Glyph->y_offset + Y;
+                uint8_t Level = Test_Level(Font, Glyph, X, Y);
+                if (Level == 0 || Xpoint < 0 || Ypoint < 0 || Xpoint >= 240 || Ypoint >= 240)
+                    continue;
+
+                uint32_t Addr = (Ypoint * 240 + Xpoint) * 2;
+                uint16_t Background = (Test_Expected[Addr] << 8) | Test_Expected[Addr + 1];
+                uint16_t Blended = Test_Blend(Background, Color, Level, Max);
+                Test_Expected[Addr] = Blended >> 8;
+                Test_Expected[Addr + 1] = Blended & 0xff;
+            }
+        }
+
+        Pen += Glyph->advance;
+        // the width already knows how to kern, one pair at a time
+        if (*(pString + 1) != '\0') {
+            char Pair[3] = {*pString, *(pString + 1), '\0'};
+            Pen += Test_Width(Pair, Font) - Glyph->advance -
+                   Test_Width(Pair + 1, Font);
+        }
+    }
+}
+
+static uint8_t Test_Close(uint16_t A, uint16_t B)
+{
+    int16_t Red = (A >> 11) - (B >> 11);
+    int16_t Green = ((A >> 5) & 0x3f) - ((B >> 5) & 0x3f);
+    int16_t Blue = (A & 0x1f) - (B & 0x1f);
+    return abs(Red) <= 1 && abs(Green) <= 1 && abs(Blue) <= 1;
+}
+
+int main(void)
+{
+    const aFONT *Font = &lato_20;
+    uint32_t Failures = 0;
+    char Text[16];
+
+    // the pair lookup binary searches
+    for (uint16_t i = 1; i < Font->kerning_size; i++) {
+        uint16_t Previous = (Font->kerning[i - 1].left << 8) | Font->kerning[i - 1].right;
+        uint16_t Key = (Font->kerning[i].left << 8) | Font->kerning[i].right;
+        if (Previous >= Key) {
+            printf("kerning not sorted at %u\n", i);
+            Failures++;
+        }
+    }
+
+    for (uint16_t Left = Font->first; Left <= Font->last; Left++) {
+        for (uint16_t Right = Font->first; Right <= Font->last; Right++) {
+            Text[0] = Left;
+            Text[1] = Right;
+            Text[2] = '\0';
+            if (Paint_GetStringWidth_AA(Text, Font) != Test_Width(Text, Font)) {
+                printf("width of \"%s\" is %u, table says %u\n", Text,
+                       Paint_GetStringWidth_AA(Text, Font), Test_Width(Text, Font));
+                Failures++;
+            }
+        }
+    }
+
+    Paint_NewImage(Test_Image, 240, 240, ROTATE_0, WHITE);
+    Paint_SetScale(65);
+    srand(1);
+
+    for (uint32_t Round = 0; Round < TEST_ROUNDS; Round++) {
+        uint8_t Length = 1 + rand() % (sizeof(Text) - 1);
+        for (uint8_t i = 0; i < Length; i++)
+            Text[i] = Font->first + rand() % (Font->last - Font->first + 1);
+        Text[Length] = '\0';
+
+        if (Paint_GetStringWidth_AA(Text, Font) != Test_Width(Text, Font)) {
+            printf("width of \"%s\" is %u, table says %u\n", Text,
+                   Paint_GetStringWidth_AA(Text, Font), Test_Width(Text, Font));
+            Failures++;
+        }
+
+        for (uint32_t i = 0; i < sizeof(Test_Image); i++)
+            Test_Image[i] = rand();
+        memcpy(Test_Expected, Test_Image, sizeof(Test_Image));
+
+        // reaches past every edge now and then
+        uint16_t Xstart = rand() % 260;
+        uint16_t Ystart = rand() % 250;
+        uint16_t Color = rand();
+
+        Paint_DrawString_AA(Xstart, Ystart, Text, Font, Color);
+        Test_DrawString(Xstart, Ystart, Text, Font, Color);
+
+        for (uint32_t i = 0; i < sizeof(Test_Image); i += 2) {
+            uint16_t Got = (Test_Image[i] << 8) | Test_Image[i + 1];
+            uint16_t Want = (Test_Expected[i] << 8) | Test_Expected[i + 1];
+            if (!Test_Close(Got, Want)) {
+                printf("\"%s\" at %u,%u: pixel %u,%u is %04x, want %04x\n", Text,
+                       Xstart, Ystart, i / 2 % 240, i / 2 / 240, Got, Want);
+                Failures++;
+                break;
+            }
+        }
+    }
+
+    return Failures > 0;
+}
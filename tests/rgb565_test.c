@@ -0,0 +1,181 @@
+// plain per pixel versions of every kernel, and a check that the pair
+// versions match them exactly over random pixels, alphas, lengths and
+// alignments, guard pixels included. see run.sh
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "rgb565.h"
+
+static uint16_t swapPixel(uint16_t pixel) { return pixel << 8 | pixel >> 8; }
+
+static uint32_t toWeight(uint16_t alpha) {
+	if (alpha > 256) alpha = 256;
+	return (alpha + 4) >> 3;
+}
+
+// channel by channel, to check rgb565BlendPixel
+static uint16_t channelBlend(uint16_t a, uint16_t b, uint32_t weight) {
+	a = swapPixel(a);
+	b = swapPixel(b);
+	uint32_t inverse = 32 - weight;
+	uint32_t red = ((a >> 11) * inverse + (b >> 11) * weight) >> 5;
+	uint32_t green =
+	    (((a >> 5) & 0x3f) * inverse + ((b >> 5) & 0x3f) * weight) >> 5;
+	uint32_t blue = ((a & 0x1f) * inverse + (b & 0x1f) * weight) >> 5;
+	return swapPixel(red << 11 | green << 5 | blue);
+}
+
+static void referenceBlend(uint16_t* dst, const uint16_t* src, uint32_t count,
+                           uint16_t alpha) {
+	for (uint32_t i = 0; i < count; i++) {
+		dst[i] = rgb565BlendPixel(dst[i], src[i], toWeight(alpha));
+	}
+}
+
+static void referenceBlendColor(uint16_t* dst, uint16_t color, uint32_t count,
+                                uint16_t alpha) {
+	for (uint32_t i = 0; i < count; i++) {
+		dst[i] = rgb565BlendPixel(dst[i], color, toWeight(alpha));
+	}
+}
+
+static void referenceScale(uint16_t* dst, uint32_t count,
+                           uint16_t brightness) {
+	// towards black is a blend with black
+	for (uint32_t i = 0; i < count; i++) {
+		dst[i] = rgb565BlendPixel(dst[i], 0, 32 - toWeight(brightness));
+	}
+}
+
+static void referenceSwap(uint16_t* dst, const uint16_t* src,
+                          uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) dst[i] = swapPixel(src[i]);
+}
+
+static void referenceFromGray(uint16_t* dst, const uint8_t* gray,
+                              uint32_t count) {
+	for (uint32_t i = 0; i < count; i++) {
+		uint16_t g = gray[i];
+		dst[i] = swapPixel((g >> 3) << 11 | (g >> 2) << 5 | g >> 3);
+	}
+}
+
+#define TEST_PIXELS 80
+#define TEST_ROUNDS 50000
+
+typedef enum {
+	TEST_BLEND,
+	TEST_BLEND_COLOR,
+	TEST_SCALE,
+	TEST_SWAP,
+	TEST_SWAP_IN_PLACE,
+	TEST_FROM_GRAY,
+	TEST_KERNELS,
+} TestKernel;
+
+static const char* testNames[] = {
+    "rgb565Blend", "rgb565BlendColor", "rgb565Scale",
+    "rgb565Swap",  "rgb565Swap in place", "rgb565FromGray",
+};
+
+static uint16_t randomPixel(void) { return rand() & 0xffff; }
+
+// false and prints the first difference on a mismatch
+static bool testRound(TestKernel kernel) {
+	// word aligned, offsets pick the alignment
+	static uint32_t expectedWords[TEST_PIXELS / 2 + 1];
+	static uint32_t actualWords[TEST_PIXELS / 2 + 1];
+	static uint32_t srcWords[TEST_PIXELS / 2 + 1];
+	uint16_t* expected = (uint16_t*)expectedWords;
+	uint16_t* actual = (uint16_t*)actualWords;
+	uint16_t* srcPixels = (uint16_t*)srcWords;
+	uint8_t gray[TEST_PIXELS];
+
+	for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+		expected[i] = actual[i] = randomPixel();
+		srcPixels[i] = randomPixel();
+		gray[i] = rand();
+	}
+
+	uint32_t dstOffset = rand() % 2;
+	uint32_t srcOffset = rand() % 2;
+	// guard pixels either side of dst
+	uint32_t count = rand() % (TEST_PIXELS - 4);
+	uint16_t alpha = rand() % 300;
+	uint16_t color = randomPixel();
+	uint16_t* dst = actual + 1 + dstOffset;
+	uint16_t* ref = expected + 1 + dstOffset;
+	const uint16_t* src = srcPixels + srcOffset;
+
+	switch (kernel) {
+	case TEST_BLEND:
+		rgb565Blend(dst, src, count, alpha);
+		referenceBlend(ref, src, count, alpha);
+		break;
+	case TEST_BLEND_COLOR:
+		rgb565BlendColor(dst, color, count, alpha);
+		referenceBlendColor(ref, color, count, alpha);
+		break;
+	case TEST_SCALE:
+		rgb565Scale(dst, count, alpha);
+		referenceScale(ref, count, alpha);
+		break;
+	case TEST_SWAP:
+		rgb565Swap(dst, src, count);
+		referenceSwap(ref, src, count);
+		break;
+	case TEST_SWAP_IN_PLACE:
+		rgb565Swap(dst, dst, count);
+		referenceSwap(ref, ref, count);
+		break;
+	case TEST_FROM_GRAY:
+		rgb565FromGray(dst, gray + srcOffset, count);
+		referenceFromGray(ref, gray + srcOffset, count);
+		break;
+	default:
+		break;
+	}
+
+	for (uint32_t i = 0; i < TEST_PIXELS; i++) {
+		if (actual[i] != expected[i]) {
+			printf("%s: pixel %d of %u, dst offset %u, src offset %u, alpha "
+			       "%u: %04x, expected %04x\n",
+			       testNames[kernel], (int)i - 1 - (int)dstOffset, count,
+			       dstOffset, srcOffset, alpha, actual[i], expected[i]);
+			return false;
+		}
+	}
+	return true;
+}
+
+int main(void) {
+	srand(38);
+	bool passed = true;
+
+	for (uint32_t i = 0; i < TEST_ROUNDS * 10; i++) {
+		uint16_t a = randomPixel(), b = randomPixel();
+		uint32_t weight = i % 33;
+		if (rgb565BlendPixel(a, b, weight) != channelBlend(a, b, weight)) {
+			printf("rgb565BlendPixel: %04x over %04x, weight %u: %04x, "
+			       "expected %04x\n",
+			       b, a, weight, rgb565BlendPixel(a, b, weight),
+			       channelBlend(a, b, weight));
+			passed = false;
+			break;
+		}
+	}
+	printf("%s rgb565BlendPixel\n", passed ? "ok  " : "FAIL");
+
+	for (TestKernel kernel = 0; kernel < TEST_KERNELS; kernel++) {
+		uint32_t round = 0;
+		while (round < TEST_ROUNDS && testRound(kernel)) round++;
+		if (round < TEST_ROUNDS) passed = false;
+		printf("%s %s\n", round < TEST_ROUNDS ? "FAIL" : "ok  ",
+		       testNames[kernel]);
+	}
+
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,63 @@
+#!/bin/sh
+# host tests, needs gcc. run from anywhere: tests/run.sh
+cd "$(dirname "$0")/.." || exit 1
+
+build=$(mktemp -d)
+trap 'rm -rf "$build"' EXIT
+failed=0
+
+check() {
+	if [ "$1" -eq 0 ]; then
+		echo "ok   $2"
+	else
+		echo "FAIL $2"
+		failed=1
+	fi
+}
+
+# gestures, each trace replays to its .expected output. after changing the
+# recognizer on purpose, regenerate them with the replay tool, see gesture.h
+gcc -Wall -Werror -DGESTURE_HOST_REPLAY -Isrc src/gesture.c \
+	-o "$build/gesture-replay" || exit 1
+for trace in tests/gestures/*.trace; do
+	"$build/gesture-replay" < "$trace" | diff -u "${trace%.trace}.expected" -
+	check $? "$trace"
+done
+
+# pixel kernels against plain per pixel versions, see rgb565_test.c
+gcc -O2 -Wall -Werror -Isrc tests/rgb565_test.c src/rgb565.c \
+	-o "$build/rgb565-test" || exit 1
+"$build/rgb565-test"
+check $? "rgb565 kernels"
+
+# anti-aliased text against the font compiler's output, see paint_test.c.
+# tests/stubs stands in for the pico sdk headers, the vendor code trips
+# -Wparentheses
+gcc -O2 -Wall -Werror -Wno-parentheses -Itests/stubs -Ilib/Config \
+	-Ilib/Fonts -Ilib/GUI tests/paint_test.c lib/GUI/GUI_Paint.c \
+	lib/Fonts/*.c -o "$build/paint-test" || exit 1
+"$build/paint-test"
+check $? "anti-aliased text"
+
+# distance field glyphs against a floating point version, see sdf_test.c
+gcc -O2 -Wall -Werror -Isrc tests/sdf_test.c src/sdf.c -lm \
+	-o "$build/sdf-test" || exit 1
+"$build/sdf-test"
+check $? "sdf glyphs"
+
+# scene damage and the windows sceneRender sends, see scene_test.c
+gcc -O2 -Wall -Werror -Wno-parentheses -Itests/stubs -Ilib/Config \
+	-Ilib/Fonts -Ilib/GUI -Isrc tests/scene_test.c src/scene.c \
+	lib/GUI/GUI_Paint.c lib/Fonts/*.c -o "$build/scene-test" || exit 1
+"$build/scene-test"
+check $? "scene damage"
+
+# vector fills against their exact area and the nonzero rule, see
+# vector_test.c
+gcc -O2 -Wall -Werror -Wno-parentheses -Itests/stubs -Ilib/Config \
+	-Ilib/Fonts -Ilib/GUI -Isrc tests/vector_test.c src/vector.c \
+	lib/GUI/GUI_Paint.c lib/Fonts/*.c -o "$build/vector-test" || exit 1
+"$build/vector-test"
+check $? "vector coverage"
+
+exit $failed
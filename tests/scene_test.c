@@ -0,0 +1,180 @@
+// scene damage tracking and what sceneRender sends, with the pipeline
+// stubbed out to record each window. see run.sh
+
+#include <stdio.h>
+#include <string.h>
+
+#include "GUI_Paint.h"
+#include "scene.h"
+
+// the pipeline, double buffered
+
+static uint16_t buffers[2][SCENE_WIDTH * SCENE_HEIGHT];
+static uint8_t current;
+static SceneRect sent[SCENE_MAX_DAMAGE];
+static uint8_t sentCount;
+
+uint16_t* pipelineBuffer(void) {
+	current ^= 1;
+	return buffers[current];
+}
+
+void pipelineSubmitWindow(uint16_t x0, uint16_t y0, uint16_t x1,
+                          uint16_t y1) {
+	// only the buffer being rendered is sent
+	sent[sentCount++] = (SceneRect){x0, y0, x1, y1};
+}
+
+static int failures;
+
+static void expect(const char* name, bool ok) {
+	if (!ok) {
+		printf("%s\n", name);
+		failures++;
+	}
+}
+
+static bool rectEqual(SceneRect a, SceneRect b) {
+	return a.x0 == b.x0 && a.y0 == b.y0 && a.x1 == b.x1 && a.y1 == b.y1;
+}
+
+// damage in any order
+static bool hasDamage(Scene* scene, SceneRect rect) {
+	for (uint8_t i = 0; i < scene->damageCount; i++) {
+		if (rectEqual(scene->damage[i], rect)) return true;
+	}
+	return false;
+}
+
+static void render(Scene* scene) {
+	current = 0;
+	sentCount = 0;
+	sceneRender(scene, buffers[current]);
+}
+
+// pixels of color inside rect, in the buffer the last render ended on
+static int32_t countColor(SceneRect rect, uint16_t color) {
+	int32_t count = 0;
+	for (int16_t y = rect.y0; y < rect.y1; y++) {
+		for (int16_t x = rect.x0; x < rect.x1; x++) {
+			if (buffers[current][y * SCENE_WIDTH + x] == color) count++;
+		}
+	}
+	return count;
+}
+
+int main(void) {
+	Scene scene;
+	Node group, box, other, arc;
+
+	// the first render is the whole screen
+	sceneInit(&scene, 0x0000);
+	expect("init damages the screen",
+	       scene.damageCount == 1 &&
+	           hasDamage(&scene, (SceneRect){0, 0, SCENE_WIDTH, SCENE_HEIGHT}));
+	render(&scene);
+	expect("init sends one window",
+	       sentCount == 1 &&
+	           rectEqual(sent[0], (SceneRect){0, 0, SCENE_WIDTH, SCENE_HEIGHT}));
+	expect("render clears the damage", scene.damageCount == 0);
+	render(&scene);
+	expect("nothing to send", sentCount == 0);
+
+	// a node in a group, positions add up
+	nodeInitGroup(&group, 100, 50);
+	nodeInitRect(&box, 10, 10, 20, 20, 0xffff);
+	sceneAdd(&scene, NULL, &group);
+	sceneAdd(&scene, &group, &box);
+	expect("add damages the node",
+	       scene.damageCount == 1 &&
+	           hasDamage(&scene, (SceneRect){110, 60, 130, 80}));
+	render(&scene);
+	expect("add sends the node",
+	       sentCount == 1 && rectEqual(sent[0], (SceneRect){110, 60, 130, 80}));
+	expect("node drawn",
+	       countColor((SceneRect){110, 60, 130, 80}, 0xffff) == 20 * 20);
+
+	// overlapping old and new places merge
+	nodeSetPosition(&box, 20, 10);
+	expect("move merges", scene.damageCount == 1 &&
+	                          hasDamage(&scene, (SceneRect){110, 60, 140, 80}));
+	render(&scene);
+	expect("move sends one window",
+	       sentCount == 1 && rectEqual(sent[0], (SceneRect){110, 60, 140, 80}));
+	expect("old place cleared",
+	       countColor((SceneRect){110, 60, 120, 80}, 0x0000) == 10 * 20);
+	expect("new place drawn",
+	       countColor((SceneRect){120, 60, 140, 80}, 0xffff) == 20 * 20);
+
+	// apart they stay apart, and are sent one at a time
+	nodeSetPosition(&box, 100, 100);
+	expect("move apart",
+	       scene.damageCount == 2 &&
+	           hasDamage(&scene, (SceneRect){120, 60, 140, 80}) &&
+	           hasDamage(&scene, (SceneRect){200, 150, 220, 170}));
+	render(&scene);
+	expect("move apart sends two windows", sentCount == 2);
+
+	// one that bridges two folds both in
+	sceneDamage(&scene, (SceneRect){0, 0, 10, 10});
+	sceneDamage(&scene, (SceneRect){20, 0, 30, 10});
+	sceneDamage(&scene, (SceneRect){5, 5, 25, 8});
+	expect("bridge merges all three",
+	       scene.damageCount == 1 &&
+	           hasDamage(&scene, (SceneRect){0, 0, 30, 10}));
+
+	// clipped to the screen, and empty is nothing
+	sceneDamage(&scene, (SceneRect){230, 230, 260, 260});
+	sceneDamage(&scene, (SceneRect){50, 50, 50, 60});
+	expect("clip and empty",
+	       scene.damageCount == 2 &&
+	           hasDamage(&scene, (SceneRect){230, 230, 240, 240}));
+	render(&scene);
+
+	// out of slots, the one that grows least takes the new one
+	sceneDamage(&scene, (SceneRect){0, 0, 10, 10});
+	sceneDamage(&scene, (SceneRect){100, 0, 110, 10});
+	sceneDamage(&scene, (SceneRect){0, 100, 10, 110});
+	sceneDamage(&scene, (SceneRect){100, 100, 110, 110});
+	sceneDamage(&scene, (SceneRect){100, 120, 110, 130});
+	expect("full merges the nearest",
+	       scene.damageCount == SCENE_MAX_DAMAGE &&
+	           hasDamage(&scene, (SceneRect){100, 100, 110, 130}) &&
+	           hasDamage(&scene, (SceneRect){0, 0, 10, 10}));
+	render(&scene);
+	expect("full sends every slot", sentCount == SCENE_MAX_DAMAGE);
+
+	// hidden and removed nodes are cleared
+	nodeInitRect(&other, 0, 0, 10, 10, 0x1234);
+	sceneAdd(&scene, NULL, &other);
+	render(&scene);
+	expect("other drawn", countColor((SceneRect){0, 0, 10, 10}, 0x1234) == 100);
+	nodeSetVisible(&other, false);
+	render(&scene);
+	expect("hidden cleared",
+	       sentCount == 1 && countColor((SceneRect){0, 0, 10, 10}, 0) == 100);
+	sceneRemove(&group);
+	render(&scene);
+	expect("removed cleared",
+	       sentCount == 1 &&
+	           rectEqual(sent[0], (SceneRect){200, 150, 220, 170}) &&
+	           countColor((SceneRect){200, 150, 220, 170}, 0) == 400);
+
+	// arcs: a half turn is half the ring, no sweep is nothing. odd so a
+	// row of pixel centers runs along the edges
+	nodeInitArc(&arc, 60, 60, 101, 10, 0, ANGLE_FULL_TURN / 2, 0xffff);
+	sceneAdd(&scene, NULL, &arc);
+	render(&scene);
+	SceneRect ring = {60, 60, 161, 161};
+	int32_t right = countColor((SceneRect){110, 60, 161, 161}, 0xffff);
+	expect("half turn on the right",
+	       right > 0 && countColor(ring, 0xffff) == right);
+	nodeSetArcAngles(&arc, ANGLE_FULL_TURN / 4, ANGLE_FULL_TURN / 4);
+	render(&scene);
+	expect("no sweep draws nothing", countColor(ring, 0xffff) == 0);
+	nodeSetArcAngles(&arc, 0, ANGLE_FULL_TURN);
+	render(&scene);
+	expect("full turn", countColor(ring, 0xffff) > 2 * right - 100);
+
+	return failures > 0;
+}
@@ -0,0 +1,165 @@
+// sdfDraw against a floating point version of the same field sampling,
+// over random positions, zooms and styles, partly off screen. see run.sh
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/images/font24_maki_sdf.h"
+#include "sdf.h"
+
+#define TEST_ROUNDS 400
+// channel steps the fixed point math may be off by. the blend weight is 5
+// bits, and steep edges at high zoom add a step or two on a few pixels
+#define TEST_TOLERANCE 2
+#define TEST_WORST 4
+// of every pixel compared, past TEST_TOLERANCE
+#define TEST_OUTLIERS 0.0001
+
+static uint16_t buffer[SDF_WIDTH * SDF_HEIGHT];
+static uint16_t expected[SDF_WIDTH * SDF_HEIGHT];
+
+static uint16_t swapPixel(uint16_t pixel) { return pixel << 8 | pixel >> 8; }
+
+static double sample(const uint8_t* data, const SdfField* field, double u,
+                     double v) {
+	int x = floor(u), y = floor(v);
+	double fx = u - x, fy = v - y;
+	int x0 = x < 0 ? 0 : x, y0 = y < 0 ? 0 : y;
+	int x1 = x + 1 >= field->width ? field->width - 1 : x + 1;
+	int y1 = y + 1 >= field->height ? field->height - 1 : y + 1;
+
+	double top = data[y0 * field->width + x0] * (1 - fx) +
+	             data[y0 * field->width + x1] * fx;
+	double bottom = data[y1 * field->width + x0] * (1 - fx) +
+	                data[y1 * field->width + x1] * fx;
+	return top * (1 - fy) + bottom * fy;
+}
+
+static uint16_t blend(uint16_t under, uint16_t over, double alpha) {
+	if (alpha <= 0) return under;
+	if (alpha >= 1) return over;
+
+	under = swapPixel(under);
+	over = swapPixel(over);
+	uint16_t result = 0;
+	const int shift[3] = {11, 5, 0}, mask[3] = {0x1f, 0x3f, 0x1f};
+	for (int i = 0; i < 3; i++) {
+		double a = (under >> shift[i]) & mask[i];
+		double b = (over >> shift[i]) & mask[i];
+		result |= (uint16_t)lround(a + (b - a) * alpha) << shift[i];
+	}
+	return swapPixel(result);
+}
+
+static void referenceDraw(const SdfField* field, uint8_t glyph, int x, int y,
+                          int32_t fixedZoom, const SdfStyle* style) {
+	const uint8_t* data = &field->data[glyph * field->width * field->height];
+	double zoom = fixedZoom / 65536.0;
+	// whole screen pixels, as sdfDraw rounds them
+	int width = ((int32_t)field->width * fixedZoom) >> 16;
+	int height = ((int32_t)field->height * fixedZoom) >> 16;
+	double outline = style->outlineWidth / 256.0;
+	double glow = style->glowWidth / 256.0;
+
+	for (int row = 0; row < SDF_HEIGHT; row++) {
+		for (int column = 0; column < SDF_WIDTH; column++) {
+			// pixel centers onto field pixel centers
+			double u = (column - x + 0.5) / zoom - 0.5;
+			double v = (row - y + 0.5) / zoom - 0.5;
+			if (column < x || row < y || column >= x + width ||
+			    row >= y + height) {
+				continue;
+			}
+
+			double distance =
+			    (sample(data, field, u, v) - 128) / 127 * field->spread * zoom;
+
+			uint16_t* pixel = &expected[row * SDF_WIDTH + column];
+			if (glow > 0) {
+				double outside = distance + outline;
+				*pixel = blend(*pixel, style->glowColor,
+				               outside >= 0 ? 1 : 1 + outside / glow);
+			}
+			if (outline > 0) {
+				*pixel = blend(*pixel, style->outlineColor,
+				               distance + outline + 0.5);
+			}
+			*pixel = blend(*pixel, style->color, distance + 0.5);
+		}
+	}
+}
+
+static int channelError(uint16_t a, uint16_t b) {
+	a = swapPixel(a);
+	b = swapPixel(b);
+	int red = abs((a >> 11) - (b >> 11));
+	int green = abs(((a >> 5) & 0x3f) - ((b >> 5) & 0x3f));
+	int blue = abs((a & 0x1f) - (b & 0x1f));
+	int worst = red > green ? red : green;
+	return worst > blue ? worst : blue;
+}
+
+int main(void) {
+	const SdfField* field = &font24_maki_sdf;
+	int failures = 0;
+	long outliers = 0;
+	srand(1);
+
+	for (int round = 0; round < TEST_ROUNDS; round++) {
+		uint8_t glyph = rand() % field->count;
+		int32_t zoom = 32768 + rand() % (6 * 65536);
+		int16_t x = rand() % 300 - 60;
+		int16_t y = rand() % 300 - 60;
+		SdfStyle style = {
+		    .color = rand(),
+		    .outlineColor = rand(),
+		    .glowColor = rand(),
+		    .outlineWidth = rand() % 3 == 0 ? 0 : rand() % (4 * 256),
+		    .glowWidth = rand() % 3 == 0 ? 0 : 64 + rand() % (10 * 256),
+		};
+
+		for (int i = 0; i < SDF_WIDTH * SDF_HEIGHT; i++) buffer[i] = rand();
+		memcpy(expected, buffer, sizeof(buffer));
+
+		sdfDraw(buffer, field, glyph, x, y, zoom, &style);
+		referenceDraw(field, glyph, x, y, zoom, &style);
+
+		for (int i = 0; i < SDF_WIDTH * SDF_HEIGHT; i++) {
+			int error = channelError(buffer[i], expected[i]);
+			if (error > TEST_TOLERANCE) outliers++;
+			if (error > TEST_WORST) {
+				printf("glyph %u at %d,%d zoom %d: pixel %d,%d is %04x, want "
+				       "%04x\n",
+				       glyph, x, y, zoom, i % SDF_WIDTH, i / SDF_WIDTH,
+				       buffer[i], expected[i]);
+				failures++;
+				break;
+			}
+		}
+	}
+
+	if (outliers > TEST_OUTLIERS * TEST_ROUNDS * SDF_WIDTH * SDF_HEIGHT) {
+		printf("%ld pixels off by more than %d\n", outliers, TEST_TOLERANCE);
+		failures++;
+	}
+
+	// the string keeps only the glyphs the field has, in their order
+	SdfStyle plain = {.color = 0xffff};
+	memset(buffer, 0, sizeof(buffer));
+	memset(expected, 0, sizeof(expected));
+	sdfDrawString(buffer, field, "mxk", 10, 20, 65536, &plain);
+	referenceDraw(field, 3, 10, 20, 65536, &plain);
+	referenceDraw(field, 2, 10 + 2 * field->advance, 20, 65536, &plain);
+	for (int i = 0; i < SDF_WIDTH * SDF_HEIGHT; i++) {
+		if (channelError(buffer[i], expected[i]) > TEST_TOLERANCE) {
+			printf("\"mxk\": pixel %d,%d is %04x, want %04x\n", i % SDF_WIDTH,
+			       i / SDF_WIDTH, buffer[i], expected[i]);
+			failures++;
+			break;
+		}
+	}
+
+	return failures > 0;
+}
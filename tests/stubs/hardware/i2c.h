@@ -0,0 +1,8 @@
+#ifndef TESTS_STUBS_HARDWARE_I2C_H
+#define TESTS_STUBS_HARDWARE_I2C_H
+
+#include "pico/stdlib.h"
+
+typedef struct i2c_inst i2c_inst_t;
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef TESTS_STUBS_HARDWARE_PWM_H
+#define TESTS_STUBS_HARDWARE_PWM_H
+
+#include "pico/stdlib.h"
+
+#endif
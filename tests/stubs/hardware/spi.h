@@ -0,0 +1,8 @@
+#ifndef TESTS_STUBS_HARDWARE_SPI_H
+#define TESTS_STUBS_HARDWARE_SPI_H
+
+#include "pico/stdlib.h"
+
+typedef struct spi_inst spi_inst_t;
+
+#endif
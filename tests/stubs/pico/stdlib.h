@@ -0,0 +1,12 @@
+// just the declarations lib/Config/DEV_Config.h needs, for host tests
+#ifndef TESTS_STUBS_PICO_STDLIB_H
+#define TESTS_STUBS_PICO_STDLIB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
+typedef void (*gpio_irq_callback_t)(uint gpio, uint32_t events);
+
+#endif
@@ -0,0 +1,161 @@
+// vectorDraw coverage and winding: filled areas against their exact size,
+// edges of known coverage, and the nonzero rule with holes and overlaps.
+// see run.sh
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "GUI_Paint.h"
+#include "vector.h"
+
+// odd, so the view center is a pixel corner and at zoom 1 view units are
+// screen pixels
+#define TEST_VIEW 241
+
+static uint16_t buffer[VECTOR_WIDTH * VECTOR_HEIGHT];
+static uint8_t asset[8192];
+static uint32_t length;
+static int failures;
+
+static void put(uint8_t byte) { asset[length++] = byte; }
+
+static void putPoint(double x, double y) {
+	int16_t fixedX = x * 16, fixedY = y * 16;
+	put(fixedX & 0xff);
+	put(fixedX >> 8);
+	put(fixedY & 0xff);
+	put(fixedY >> 8);
+}
+
+static void begin(void) {
+	length = 0;
+	put(TEST_VIEW & 0xff);
+	put(TEST_VIEW >> 8);
+	put(TEST_VIEW & 0xff);
+	put(TEST_VIEW >> 8);
+	put(VECTOR_COLOR);
+	put(0xff);
+	put(0xff);
+	put(0xff);
+}
+
+// clockwise on screen when forward, y points down
+static void rectangle(double x0, double y0, double x1, double y1,
+                      bool forward) {
+	put(VECTOR_MOVE);
+	putPoint(x0, y0);
+	put(VECTOR_LINE);
+	putPoint(forward ? x1 : x0, forward ? y0 : y1);
+	put(VECTOR_LINE);
+	putPoint(x1, y1);
+	put(VECTOR_LINE);
+	putPoint(forward ? x0 : x1, forward ? y1 : y0);
+	put(VECTOR_CLOSE);
+}
+
+// white on black, so a pixel's green is its coverage in 1/63
+static bool draw(int16_t angle) {
+	put(VECTOR_FILL);
+	put(VECTOR_END);
+	memset(buffer, 0, sizeof(buffer));
+
+	VectorTransform transform;
+	vectorTransformInit(&transform, asset, angle, 65536, 120, 120);
+	return vectorDraw(buffer, asset, &transform);
+}
+
+static double coverage(int16_t x, int16_t y) {
+	uint16_t pixel = buffer[y * VECTOR_WIDTH + x];
+	pixel = pixel << 8 | pixel >> 8;
+	return ((pixel >> 5) & 0x3f) / 63.0;
+}
+
+static double area(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+	double total = 0;
+	for (int16_t y = y0; y < y1; y++) {
+		for (int16_t x = x0; x < x1; x++) total += coverage(x, y);
+	}
+	return total;
+}
+
+static void expectNear(const char* name, double value, double want,
+                       double tolerance) {
+	if (value < want - tolerance || value > want + tolerance) {
+		printf("%s: %.3f, want %.3f\n", name, value, want);
+		failures++;
+	}
+}
+
+int main(void) {
+	double whole = VECTOR_WIDTH;
+
+	// on pixel edges, every pixel is all in or all out
+	begin();
+	rectangle(10, 20, 50, 60, true);
+	expectNear("square drawn", draw(0), 1, 0);
+	expectNear("square inside", area(10, 20, 50, 60), 40 * 40, 0);
+	expectNear("nothing outside", area(0, 0, whole, whole), 40 * 40, 0);
+
+	// quarter pixel edges, the edge columns and rows are partly covered
+	begin();
+	rectangle(10.25, 20, 29.5, 40.75, true);
+	draw(0);
+	expectNear("left column", coverage(10, 30), 0.75, 0.04);
+	expectNear("right column", coverage(29, 30), 0.5, 0.04);
+	expectNear("bottom row", coverage(20, 40), 0.75, 0.04);
+	expectNear("fractional area", area(0, 0, whole, whole), 19.25 * 20.75,
+	           19.25 * 20.75 * 0.01);
+
+	// a triangle is half its box, the slanted edge anti-aliased
+	begin();
+	put(VECTOR_MOVE);
+	putPoint(100, 100);
+	put(VECTOR_LINE);
+	putPoint(180, 100);
+	put(VECTOR_LINE);
+	putPoint(100, 160);
+	draw(0);
+	expectNear("triangle area", area(0, 0, whole, whole), 80 * 60 / 2.0,
+	           80 * 60 / 2.0 * 0.01);
+
+	// rotated an eighth of a turn the area stays the same
+	begin();
+	rectangle(90, 90, 150, 150, true);
+	draw(ANGLE_FULL_TURN / 8);
+	expectNear("rotated area", area(0, 0, whole, whole), 60 * 60,
+	           60 * 60 * 0.01);
+	expectNear("rotated corner", coverage(92, 92), 0, 0);
+	expectNear("rotated center", coverage(120, 120), 1, 0);
+
+	// nonzero: opposite winding cuts a hole, the same winding doesn't,
+	// and overlaps are covered once
+	begin();
+	rectangle(20, 20, 80, 80, true);
+	rectangle(40, 40, 60, 60, false);
+	draw(0);
+	expectNear("hole", area(40, 40, 60, 60), 0, 0);
+	expectNear("around the hole", area(0, 0, whole, whole), 60 * 60 - 20 * 20,
+	           0);
+
+	begin();
+	rectangle(20, 20, 80, 80, true);
+	rectangle(40, 40, 60, 60, true);
+	draw(0);
+	expectNear("same winding", area(0, 0, whole, whole), 60 * 60, 0);
+
+	begin();
+	rectangle(20, 20, 60, 60, true);
+	rectangle(40, 40, 80, 80, true);
+	draw(0);
+	expectNear("overlap", area(0, 0, whole, whole), 2 * 40 * 40 - 20 * 20, 0);
+
+	// past the edge table it says so, and draws what fit
+	begin();
+	for (int i = 0; i < VECTOR_MAX_EDGES / 2 + 1; i++) {
+		rectangle(i % 200, i / 200 * 20, i % 200 + 1, i / 200 * 20 + 10, true);
+	}
+	expectNear("too many edges", draw(0), 0, 0);
+
+	return failures > 0;
+}